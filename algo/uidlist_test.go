@@ -18,6 +18,7 @@ package algo
 
 import (
 	"fmt"
+	"github.com/dgraph-io/dgraph/bench"
 	"github.com/dgraph-io/dgraph/task"
 	"github.com/stretchr/testify/require"
 	"math/rand"
@@ -273,3 +274,66 @@ func BenchmarkListIntersectRandom(b *testing.B) {
 	randomTests(10000, 0.01)
 	randomTests(1000000, 0.01)
 }
+
+// benchLists returns lists of the given sizes, with uids drawn from [1, limit].
+// Posting lists follow a power law, so most intersections are between lists of
+// very different sizes.
+func benchLists(sizes []int, limit uint64) []*task.List {
+	lists := make([]*task.List, len(sizes))
+	for i, n := range sizes {
+		lists[i] = newList(bench.SortedList(int64(i+1), n, limit))
+	}
+	return lists
+}
+
+var benchListSizes = [][]int{
+	{1000, 1000, 1000},
+	{100, 10000, 1000000},
+	{10000, 1000000},
+	{10, 100, 1000, 10000, 100000},
+}
+
+func listsName(sizes []int) string {
+	name := "sizes="
+	for i, n := range sizes {
+		if i > 0 {
+			name += ","
+		}
+		name += fmt.Sprintf("%d", n)
+	}
+	return name
+}
+
+func BenchmarkIntersectSorted(b *testing.B) {
+	for _, sizes := range benchListSizes {
+		b.Run(listsName(sizes), func(b *testing.B) {
+			lists := benchLists(sizes, 2000000)
+			rec := bench.NewRecorder("algo/intersect/"+listsName(sizes), b.N)
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				rec.Start()
+				IntersectSorted(lists)
+				rec.Stop()
+			}
+			b.StopTimer()
+			rec.Report(b)
+		})
+	}
+}
+
+func BenchmarkMergeSorted(b *testing.B) {
+	for _, sizes := range benchListSizes {
+		b.Run(listsName(sizes), func(b *testing.B) {
+			lists := benchLists(sizes, 2000000)
+			rec := bench.NewRecorder("algo/merge/"+listsName(sizes), b.N)
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				rec.Start()
+				MergeSorted(lists)
+				rec.Stop()
+			}
+			b.StopTimer()
+			rec.Report(b)
+		})
+	}
+}
@@ -0,0 +1,241 @@
+/*
+ * Copyright 2016 DGraph Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * 		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Package bench generates deterministic synthetic graphs, and records the
+// latency distribution of benchmarks, so that runs can be compared across
+// builds.
+package bench
+
+import (
+	"fmt"
+	"hash/fnv"
+	"math/rand"
+	"sort"
+	"strconv"
+
+	geom "github.com/twpayne/go-geom"
+
+	"github.com/dgraph-io/dgraph/task"
+	"github.com/dgraph-io/dgraph/types"
+	"github.com/dgraph-io/dgraph/x"
+)
+
+// Config describes a synthetic graph.
+type Config struct {
+	Seed      int64   // Same seed, same graph.
+	Nodes     int     // Entities have uids 1 to Nodes.
+	MaxFanout int     // Maximum number of uid edges out of an entity.
+	Skew      float64 // Zipf exponent of fan-outs, terms and popular targets. Must be > 1.
+	Vocab     int     // Number of distinct terms in string values.
+}
+
+// DefaultConfig is a small graph with a power-law fan-out, which loads in a
+// few seconds.
+var DefaultConfig = Config{
+	Seed:      1,
+	Nodes:     10000,
+	MaxFanout: 1000,
+	Skew:      1.2,
+	Vocab:     2000,
+}
+
+// Graph generates the edges of the synthetic graph. Every generator draws from
+// its own source, seeded by Config.Seed and the predicate, so the output
+// doesn't depend on which generators were called before.
+type Graph struct {
+	Config
+}
+
+// NewGraph returns a Graph for the given config.
+func NewGraph(c Config) *Graph {
+	x.AssertTruef(c.Nodes > 0 && c.MaxFanout > 0 && c.Vocab > 0,
+		"Invalid bench config: %+v", c)
+	x.AssertTruef(c.Skew > 1, "Zipf exponent must be > 1, got %v", c.Skew)
+	return &Graph{Config: c}
+}
+
+func (g *Graph) rand(attr string) *rand.Rand {
+	h := fnv.New64a()
+	h.Write([]byte(attr))
+	return rand.New(rand.NewSource(g.Seed ^ int64(h.Sum64())))
+}
+
+// Adjacency returns the sorted neighbours of each entity for attr, indexed by
+// uid-1. Fan-outs follow a power law, and so does the popularity of targets.
+func (g *Graph) Adjacency(attr string) [][]uint64 {
+	r := g.rand(attr)
+	fanout := rand.NewZipf(r, g.Skew, 1, uint64(g.MaxFanout-1))
+	target := rand.NewZipf(r, g.Skew, 1, uint64(g.Nodes-1))
+	// Shuffle the popular targets, so they aren't all small uids.
+	perm := r.Perm(g.Nodes)
+
+	adj := make([][]uint64, g.Nodes)
+	for i := range adj {
+		n := int(fanout.Uint64()) + 1
+		seen := make(map[uint64]struct{}, n)
+		for j := 0; j < n; j++ {
+			uid := uint64(perm[target.Uint64()]) + 1
+			if _, has := seen[uid]; has {
+				continue
+			}
+			seen[uid] = struct{}{}
+			adj[i] = append(adj[i], uid)
+		}
+		sort.Sort(uids(adj[i]))
+	}
+	return adj
+}
+
+// UidEdges returns the edges of Adjacency(attr).
+func (g *Graph) UidEdges(attr string) []*task.DirectedEdge {
+	var edges []*task.DirectedEdge
+	for i, dst := range g.Adjacency(attr) {
+		for _, uid := range dst {
+			edges = append(edges, &task.DirectedEdge{
+				Entity:  uint64(i) + 1,
+				Attr:    attr,
+				ValueId: uid,
+				Label:   "bench",
+				Op:      task.DirectedEdge_SET,
+			})
+		}
+	}
+	return edges
+}
+
+// Term returns the i-th term of the vocabulary.
+func Term(i int) string { return "term" + strconv.Itoa(i) }
+
+// Terms returns the given number of terms, following the Zipf distribution of
+// terms in StringEdges.
+func (g *Graph) Terms(attr string, n int) []string {
+	r := g.rand("terms/" + attr)
+	z := rand.NewZipf(r, g.Skew, 1, uint64(g.Vocab-1))
+	out := make([]string, n)
+	for i := range out {
+		out[i] = Term(int(z.Uint64()))
+	}
+	return out
+}
+
+// StringEdges gives each entity a string value of two to four terms, drawn
+// with a Zipf distribution from the vocabulary.
+func (g *Graph) StringEdges(attr string) []*task.DirectedEdge {
+	r := g.rand(attr)
+	z := rand.NewZipf(r, g.Skew, 1, uint64(g.Vocab-1))
+	edges := make([]*task.DirectedEdge, 0, g.Nodes)
+	for uid := 1; uid <= g.Nodes; uid++ {
+		var val []byte
+		for j := 2 + r.Intn(3); j > 0; j-- {
+			if len(val) > 0 {
+				val = append(val, ' ')
+			}
+			val = append(val, Term(int(z.Uint64()))...)
+		}
+		edges = append(edges, g.valueEdge(uid, attr, types.StringID, string(val)))
+	}
+	return edges
+}
+
+// IntEdges gives each entity an int value, uniform in [0, max).
+func (g *Graph) IntEdges(attr string, max int) []*task.DirectedEdge {
+	r := g.rand(attr)
+	edges := make([]*task.DirectedEdge, 0, g.Nodes)
+	for uid := 1; uid <= g.Nodes; uid++ {
+		edges = append(edges, g.valueEdge(uid, attr, types.Int32ID, int32(r.Intn(max))))
+	}
+	return edges
+}
+
+// GeoBox is the area in which GeoEdges places its points, as
+// min longitude, min latitude, max longitude, max latitude.
+var GeoBox = [4]float64{-122.52, 37.70, -122.35, 37.82}
+
+// GeoEdges gives each entity a point value, uniform within GeoBox.
+func (g *Graph) GeoEdges(attr string) []*task.DirectedEdge {
+	r := g.rand(attr)
+	edges := make([]*task.DirectedEdge, 0, g.Nodes)
+	for uid := 1; uid <= g.Nodes; uid++ {
+		lng := GeoBox[0] + r.Float64()*(GeoBox[2]-GeoBox[0])
+		lat := GeoBox[1] + r.Float64()*(GeoBox[3]-GeoBox[1])
+		p := geom.NewPoint(geom.XY).MustSetCoords(geom.Coord{lng, lat})
+		edges = append(edges, g.valueEdge(uid, attr, types.GeoID, geom.T(p)))
+	}
+	return edges
+}
+
+// NearArgs returns the arguments of a near function around a random point in
+// GeoBox, with the given distance in metres.
+func (g *Graph) NearArgs(attr string, i int, dist int) []string {
+	r := g.rand(fmt.Sprintf("near/%s/%d", attr, i))
+	lng := GeoBox[0] + r.Float64()*(GeoBox[2]-GeoBox[0])
+	lat := GeoBox[1] + r.Float64()*(GeoBox[3]-GeoBox[1])
+	return []string{"near",
+		fmt.Sprintf("[%f,%f]", lng, lat),
+		strconv.Itoa(dist)}
+}
+
+func (g *Graph) valueEdge(uid int, attr string, tid types.TypeID,
+	v interface{}) *task.DirectedEdge {
+	b := types.ValueForType(types.BinaryID)
+	x.Check(types.Marshal(types.Val{Tid: tid, Value: v}, &b))
+	return &task.DirectedEdge{
+		Entity:    uint64(uid),
+		Attr:      attr,
+		Value:     b.Value.([]byte),
+		ValueType: uint32(tid),
+		Label:     "bench",
+		Op:        task.DirectedEdge_SET,
+	}
+}
+
+// Uids returns n distinct uids of the graph, sorted.
+func (g *Graph) Uids(seed string, n int) []uint64 {
+	if n > g.Nodes {
+		n = g.Nodes
+	}
+	r := g.rand("uids/" + seed)
+	out := make([]uint64, n)
+	for i, v := range r.Perm(g.Nodes)[:n] {
+		out[i] = uint64(v) + 1
+	}
+	sort.Sort(uids(out))
+	return out
+}
+
+// SortedList returns a sorted list of n distinct uids in [1, limit].
+func SortedList(seed int64, n int, limit uint64) []uint64 {
+	x.AssertTruef(uint64(n) <= limit, "Can't pick %d uids out of %d", n, limit)
+	r := rand.New(rand.NewSource(seed))
+	seen := make(map[uint64]struct{}, n)
+	out := make([]uint64, 0, n)
+	for len(out) < n {
+		uid := uint64(r.Int63n(int64(limit))) + 1
+		if _, has := seen[uid]; has {
+			continue
+		}
+		seen[uid] = struct{}{}
+		out = append(out, uid)
+	}
+	sort.Sort(uids(out))
+	return out
+}
+
+type uids []uint64
+
+func (u uids) Len() int           { return len(u) }
+func (u uids) Less(i, j int) bool { return u[i] < u[j] }
+func (u uids) Swap(i, j int)      { u[i], u[j] = u[j], u[i] }
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2016 DGraph Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * 		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package bench
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+func TestGraphDeterministic(t *testing.T) {
+	c := Config{Seed: 7, Nodes: 500, MaxFanout: 100, Skew: 1.5, Vocab: 50}
+	g1, g2 := NewGraph(c), NewGraph(c)
+
+	// Calling another generator first mustn't change the output.
+	g2.StringEdges("name")
+	require.Equal(t, g1.Adjacency("friend"), g2.Adjacency("friend"))
+	require.Equal(t, g1.IntEdges("age", 100), g2.IntEdges("age", 100))
+	require.Equal(t, g1.GeoEdges("loc"), g2.GeoEdges("loc"))
+	require.Equal(t, g1.StringEdges("name"), g2.StringEdges("name"))
+	require.NotEqual(t, g1.Adjacency("friend"), g1.Adjacency("follows"))
+
+	c.Seed = 8
+	require.NotEqual(t, g1.Adjacency("friend"), NewGraph(c).Adjacency("friend"))
+}
+
+func TestGraphFanout(t *testing.T) {
+	g := NewGraph(Config{Seed: 1, Nodes: 2000, MaxFanout: 500, Skew: 1.2, Vocab: 50})
+	adj := g.Adjacency("friend")
+	require.Equal(t, 2000, len(adj))
+
+	var small, max int
+	for _, dst := range adj {
+		require.True(t, len(dst) > 0 && len(dst) <= 500)
+		for i := 1; i < len(dst); i++ {
+			require.True(t, dst[i-1] < dst[i])
+		}
+		if len(dst) <= 2 {
+			small++
+		}
+		if len(dst) > max {
+			max = len(dst)
+		}
+	}
+	// Power law: most entities have few edges, but some have a lot.
+	require.True(t, small > len(adj)/4, "small: %d", small)
+	require.True(t, max > 50, "max: %d", max)
+}
+
+func TestSortedList(t *testing.T) {
+	l := SortedList(3, 100, 150)
+	require.Equal(t, 100, len(l))
+	require.Equal(t, l, SortedList(3, 100, 150))
+	for i := 1; i < len(l); i++ {
+		require.True(t, l[i-1] < l[i] && l[i] <= 150)
+	}
+}
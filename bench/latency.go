@@ -0,0 +1,136 @@
+/*
+ * Copyright 2016 DGraph Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * 		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package bench
+
+import (
+	"encoding/json"
+	"flag"
+	"os"
+	"sort"
+	"sync"
+	"time"
+
+	"github.com/dgraph-io/dgraph/x"
+)
+
+var (
+	outFile = flag.String("bench_out", "",
+		"File to append the latency summary of each benchmark to, as JSON lines.")
+	buildTag = flag.String("bench_tag", "",
+		"Tag stored with each summary, to tell builds apart.")
+
+	outMu sync.Mutex
+)
+
+// Logger is the part of testing.B used by Report.
+type Logger interface {
+	Logf(format string, args ...interface{})
+}
+
+// Recorder records the latency of each op of a benchmark.
+type Recorder struct {
+	name  string
+	lats  []time.Duration
+	start time.Time
+}
+
+// NewRecorder returns a Recorder for a benchmark with the given name, with
+// room for n ops.
+func NewRecorder(name string, n int) *Recorder {
+	return &Recorder{name: name, lats: make([]time.Duration, 0, n)}
+}
+
+// Start marks the start of an op.
+func (r *Recorder) Start() { r.start = time.Now() }
+
+// Stop records the time since the last Start.
+func (r *Recorder) Stop() { r.lats = append(r.lats, time.Since(r.start)) }
+
+// Record records the latency of an op which was timed elsewhere.
+func (r *Recorder) Record(d time.Duration) { r.lats = append(r.lats, d) }
+
+// Summary is the latency distribution of a benchmark. Times are in ns.
+type Summary struct {
+	Name string `json:"name"`
+	Tag  string `json:"tag,omitempty"`
+	Ops  int    `json:"ops"`
+	Mean int64  `json:"mean_ns"`
+	P50  int64  `json:"p50_ns"`
+	P90  int64  `json:"p90_ns"`
+	P99  int64  `json:"p99_ns"`
+	Max  int64  `json:"max_ns"`
+	Unix int64  `json:"unix"`
+}
+
+// Summary sorts the recorded latencies, and returns their distribution.
+func (r *Recorder) Summary() Summary {
+	s := Summary{Name: r.name, Tag: *buildTag, Ops: len(r.lats),
+		Unix: time.Now().Unix()}
+	if len(r.lats) == 0 {
+		return s
+	}
+	sort.Sort(durations(r.lats))
+	var total time.Duration
+	for _, d := range r.lats {
+		total += d
+	}
+	s.Mean = int64(total) / int64(len(r.lats))
+	s.P50 = int64(r.percentile(50))
+	s.P90 = int64(r.percentile(90))
+	s.P99 = int64(r.percentile(99))
+	s.Max = int64(r.lats[len(r.lats)-1])
+	return s
+}
+
+// percentile returns the p-th percentile of the sorted latencies, using the
+// nearest rank.
+func (r *Recorder) percentile(p int) time.Duration {
+	rank := (p*len(r.lats) + 99) / 100
+	if rank < 1 {
+		rank = 1
+	}
+	return r.lats[rank-1]
+}
+
+// Report logs the summary, and appends it to the --bench_out file, if set. A
+// benchmark function is run several times with increasing b.N, so consumers
+// of the file should keep the last line for each name.
+func (r *Recorder) Report(l Logger) {
+	s := r.Summary()
+	l.Logf("%s\t%d ops\tp50 %v\tp90 %v\tp99 %v\tmax %v", s.Name, s.Ops,
+		time.Duration(s.P50), time.Duration(s.P90), time.Duration(s.P99),
+		time.Duration(s.Max))
+	if len(*outFile) == 0 {
+		return
+	}
+
+	buf, err := json.Marshal(s)
+	x.Check(err)
+	outMu.Lock()
+	defer outMu.Unlock()
+	f, err := os.OpenFile(*outFile, os.O_WRONLY|os.O_CREATE|os.O_APPEND, 0644)
+	x.Checkf(err, "Unable to open bench output: %v", *outFile)
+	defer f.Close()
+	_, err = f.Write(append(buf, '\n'))
+	x.Check(err)
+}
+
+type durations []time.Duration
+
+func (d durations) Len() int           { return len(d) }
+func (d durations) Less(i, j int) bool { return d[i] < d[j] }
+func (d durations) Swap(i, j int)      { d[i], d[j] = d[j], d[i] }
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2016 DGraph Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * 		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package bench
+
+import (
+	"encoding/json"
+	"io/ioutil"
+	"os"
+	"strings"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/require"
+)
+
+func TestSummary(t *testing.T) {
+	r := NewRecorder("test", 100)
+	// Record 100, 99, ..., 1 microseconds.
+	for i := 100; i > 0; i-- {
+		r.Record(time.Duration(i) * time.Microsecond)
+	}
+	s := r.Summary()
+	require.Equal(t, 100, s.Ops)
+	require.EqualValues(t, 50*time.Microsecond, s.P50)
+	require.EqualValues(t, 90*time.Microsecond, s.P90)
+	require.EqualValues(t, 99*time.Microsecond, s.P99)
+	require.EqualValues(t, 100*time.Microsecond, s.Max)
+	require.EqualValues(t, 50500*time.Nanosecond, s.Mean)
+}
+
+func TestReport(t *testing.T) {
+	f, err := ioutil.TempFile("", "bench_")
+	require.NoError(t, err)
+	f.Close()
+	defer os.Remove(f.Name())
+	defer func(old string) { *outFile = old }(*outFile)
+	*outFile = f.Name()
+
+	for i := 1; i <= 2; i++ {
+		r := NewRecorder("test", 1)
+		r.Record(time.Duration(i))
+		r.Report(t)
+	}
+	buf, err := ioutil.ReadFile(f.Name())
+	require.NoError(t, err)
+	lines := strings.Split(strings.TrimSpace(string(buf)), "\n")
+	require.Equal(t, 2, len(lines))
+	var s Summary
+	require.NoError(t, json.Unmarshal([]byte(lines[1]), &s))
+	require.Equal(t, "test", s.Name)
+	require.EqualValues(t, 2, s.P99)
+}
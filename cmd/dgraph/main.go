@@ -70,6 +70,22 @@ var (
 	cpuprofile   = flag.String("cpu", "", "write cpu profile to file")
 	memprofile   = flag.String("mem", "", "write memory profile to file")
 	dumpSubgraph = flag.String("dumpsg", "", "Directory to save subgraph for testing, debugging")
+	bulk         = flag.Bool("bulk", false,
+		"Open the posting store tuned for an initial import: no auto compactions, large"+
+			" write buffers and no RocksDB WAL. The store is compacted on shutdown;"+
+			" restart without --bulk to serve. Memtables are flushed before each RAFT"+
+			" snapshot, so after a crash, the rest is replayed from the RAFT log.")
+	bulkVector = flag.Bool("bulk_vector_memtable", false,
+		"With --bulk, use a vector memtable. Inserts are cheaper, but reading keys"+
+			" which haven't been flushed yet is expensive.")
+	mmapReadOnly = flag.Bool("mmap_readonly", false,
+		"Serve queries from a read-only posting store, with mmapped table files."+
+			" Meant for stores which fit in memory, and have all their lists committed,"+
+			" like one left by --bulk. Implies --nomutations, and can't be used with --peer."+
+			" Neither RAFT entries, including the ones replayed on restart, nor RAFT"+
+			" snapshots from other replicas are applied to the store.")
+	mmapCacheMB = flag.Int("mmap_block_cache_mb", 256,
+		"With --mmap_readonly, size in MB of the cache for decompressed blocks.")
 
 	closeCh        = make(chan struct{})
 	pendingQueries = make(chan struct{}, 10000*runtime.NumCPU())
@@ -623,6 +639,17 @@ func checkFlagsAndInitDirs() {
 		numCpus, prev)
 	// Create parent directories for postings, uids and mutations
 	x.Check(os.MkdirAll(*postingDir, 0700))
+
+	if *mmapReadOnly {
+		if *bulk {
+			log.Fatal("--bulk and --mmap_readonly can't be used together.")
+		}
+		// Joining peers would copy their posting lists into the store.
+		if peer := flag.Lookup("peer"); peer != nil && len(peer.Value.String()) > 0 {
+			log.Fatal("--peer and --mmap_readonly can't be used together.")
+		}
+		*nomutations = true
+	}
 }
 
 func serveGRPC(l net.Listener) {
@@ -683,9 +710,17 @@ func main() {
 	x.Init()
 	checkFlagsAndInitDirs()
 
-	// All the writes to posting store should be synchronous. We use batched writers
-	// for posting lists, so the cost of sync writes is amortized.
-	ps, err := store.NewSyncStore(*postingDir)
+	var ps *store.Store
+	var err error
+	if *bulk {
+		ps, err = store.NewBulkStore(*postingDir, *bulkVector)
+	} else if *mmapReadOnly {
+		ps, err = store.NewMmapReadOnlyStore(*postingDir, *mmapCacheMB<<20)
+	} else {
+		// All the writes to posting store should be synchronous. We use batched writers
+		// for posting lists, so the cost of sync writes is amortized.
+		ps, err = store.NewSyncStore(*postingDir)
+	}
 	x.Checkf(err, "Error initializing postings store")
 	defer ps.Close()
 
@@ -708,4 +743,19 @@ func main() {
 		"use of closed network connection") {
 		log.Fatal(err)
 	}
+	if *bulk {
+		finishBulkLoad(ps)
+	}
+}
+
+// finishBulkLoad commits the posting lists held in memory, and runs the final
+// compaction over the store opened with --bulk. Closing the store flushes any
+// remaining writes, after which it can be opened with the serving profile.
+func finishBulkLoad(ps *store.Store) {
+	log.Println("Compacting bulk loaded postings store.")
+	start := time.Now()
+	posting.CommitLists(10)
+	x.Checkf(ps.CompactAll(), "Error while compacting postings store")
+	log.Printf("Compacted postings store in %v. Restart without --bulk to serve.",
+		time.Since(start))
 }
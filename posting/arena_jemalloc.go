@@ -0,0 +1,121 @@
+// +build embed
+
+/*
+ * Copyright 2016 DGraph Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * 		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package posting
+
+// #cgo linux CPPFLAGS: -I${SRCDIR}/../vendor/github.com/cockroachdb/c-jemalloc/linux_includes/internal/include
+// #cgo darwin CPPFLAGS: -I${SRCDIR}/../vendor/github.com/cockroachdb/c-jemalloc/darwin_includes/internal/include
+// #cgo freebsd CPPFLAGS: -I${SRCDIR}/../vendor/github.com/cockroachdb/c-jemalloc/freebsd_includes/internal/include
+// #cgo darwin LDFLAGS: -Wl,-undefined -Wl,dynamic_lookup
+// #cgo !darwin LDFLAGS: -Wl,-unresolved-symbols=ignore-all
+//
+// #include <stdint.h>
+// #include <stdio.h>
+// #include <jemalloc/jemalloc.h>
+//
+// static int dg_arena_create(unsigned* arena) {
+//   size_t sz = sizeof(*arena);
+//   return mallctl("arenas.extend", arena, &sz, NULL, 0);
+// }
+//
+// static void* dg_arena_alloc(unsigned arena, size_t size) {
+//   return mallocx(size, MALLOCX_ARENA(arena) | MALLOCX_TCACHE_NONE);
+// }
+//
+// static void dg_arena_free(void* ptr) {
+//   dallocx(ptr, MALLOCX_TCACHE_NONE);
+// }
+//
+// static int dg_arena_purge(unsigned arena) {
+//   char name[64];
+//   snprintf(name, sizeof(name), "arena.%u.purge", arena);
+//   return mallctl(name, NULL, NULL, NULL, 0);
+// }
+//
+// // dg_arena_stats refreshes the jemalloc stats, and returns the number of
+// // bytes in active and dirty pages of arena.
+// static int dg_arena_stats(unsigned arena, size_t* active, size_t* dirty) {
+//   uint64_t epoch = 1;
+//   size_t sz = sizeof(epoch);
+//   mallctl("epoch", &epoch, &sz, &epoch, sz);
+//
+//   size_t page, pactive, pdirty;
+//   char name[64];
+//   sz = sizeof(size_t);
+//   if (mallctl("arenas.page", &page, &sz, NULL, 0) != 0) return -1;
+//   snprintf(name, sizeof(name), "stats.arenas.%u.pactive", arena);
+//   if (mallctl(name, &pactive, &sz, NULL, 0) != 0) return -1;
+//   snprintf(name, sizeof(name), "stats.arenas.%u.pdirty", arena);
+//   if (mallctl(name, &pdirty, &sz, NULL, 0) != 0) return -1;
+//   *active = pactive * page;
+//   *dirty = pdirty * page;
+//   return 0;
+// }
+import "C"
+
+import (
+	"unsafe"
+
+	_ "github.com/cockroachdb/c-jemalloc"
+
+	"github.com/dgraph-io/dgraph/x"
+)
+
+// arenas are the jemalloc arenas holding the packed posting lists. Each list
+// is allocated from the arena of its shard, so the lists of a shard share
+// pages, and their memory can be purged together.
+var arenas []C.unsigned
+
+func initArenas(n int) {
+	arenas = make([]C.unsigned, n)
+	for i := range arenas {
+		x.AssertTruef(C.dg_arena_create(&arenas[i]) == 0, "Unable to create jemalloc arena")
+	}
+}
+
+func arenaAlloc(shard uint64, size int) unsafe.Pointer {
+	p := C.dg_arena_alloc(arenas[shard%uint64(len(arenas))], C.size_t(size))
+	x.AssertTruef(p != nil, "Unable to allocate %d bytes off heap", size)
+	return p
+}
+
+func arenaFree(p unsafe.Pointer) { C.dg_arena_free(p) }
+
+// purgeArenas returns the unused dirty pages of all the arenas to the OS.
+func purgeArenas() {
+	for _, a := range arenas {
+		C.dg_arena_purge(a)
+	}
+}
+
+// arenaStats returns the active and dirty bytes of each arena.
+func arenaStats() []map[string]uint64 {
+	stats := make([]map[string]uint64, 0, len(arenas))
+	for _, a := range arenas {
+		var active, dirty C.size_t
+		if C.dg_arena_stats(a, &active, &dirty) != 0 {
+			continue
+		}
+		stats = append(stats, map[string]uint64{
+			"arena":  uint64(a),
+			"active": uint64(active),
+			"dirty":  uint64(dirty),
+		})
+	}
+	return stats
+}
@@ -0,0 +1,46 @@
+// +build !embed
+
+/*
+ * Copyright 2016 DGraph Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * 		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package posting
+
+// #include <stdlib.h>
+import "C"
+
+import (
+	"unsafe"
+
+	"github.com/dgraph-io/dgraph/x"
+)
+
+// Without the vendored jemalloc, packed posting lists are allocated via the
+// system malloc. They are still kept off the Go heap, but there are no arenas
+// to purge or report on.
+
+func initArenas(n int) {}
+
+func arenaAlloc(shard uint64, size int) unsafe.Pointer {
+	p := C.malloc(C.size_t(size))
+	x.AssertTruef(p != nil, "Unable to allocate %d bytes off heap", size)
+	return p
+}
+
+func arenaFree(p unsafe.Pointer) { C.free(p) }
+
+func purgeArenas() {}
+
+func arenaStats() []map[string]uint64 { return nil }
@@ -17,9 +17,12 @@
 package posting
 
 import (
+	"bytes"
 	"context"
+	"runtime"
 	"sort"
 	"sync"
+	"sync/atomic"
 
 	"golang.org/x/net/trace"
 
@@ -104,16 +107,25 @@ func IndexTokens(attr string, src types.Val) ([]string, error) {
 	return types.IndexTokens(sv)
 }
 
-// addIndexMutations adds mutation(s) for a single term, to maintain index.
+// keyedEdge is an index or reverse edge, along with the key of the posting list
+// it applies to.
+type keyedEdge struct {
+	key   []byte
+	group uint32
+	edge  *task.DirectedEdge
+}
+
+// addIndexMutations returns the mutation(s) for a single term, to maintain index.
 // t represents the original uid -> value edge.
-func addIndexMutations(ctx context.Context, t *task.DirectedEdge, p types.Val, op task.DirectedEdge_Op) {
+func addIndexMutations(ctx context.Context, t *task.DirectedEdge, p types.Val,
+	op task.DirectedEdge_Op) []keyedEdge {
 	attr := t.Attr
 	uid := t.Entity
 	x.AssertTrue(uid != 0)
 	tokens, err := IndexTokens(attr, p)
 	if err != nil {
 		// This data is not indexable
-		return
+		return nil
 	}
 
 	// Create a value token -> uid edge.
@@ -127,47 +139,28 @@ func addIndexMutations(ctx context.Context, t *task.DirectedEdge, p types.Val, o
 	tokensTable := GetTokensTable(attr)
 	x.AssertTruef(tokensTable != nil, "TokensTable missing for attr %s", attr)
 
-	for _, token := range tokens {
-		addIndexMutation(ctx, edge, token)
-		if edge.Op == task.DirectedEdge_SET {
-			tokensTable.Add(token)
-		}
-	}
-}
-
-func addIndexMutation(ctx context.Context, edge *task.DirectedEdge, token string) {
-	key := x.IndexKey(edge.Attr, token)
-
 	var groupId uint32
 	if rv, ok := ctx.Value("raft").(x.RaftValue); ok {
 		groupId = rv.Group
 	}
 
-	plist, decr := GetOrCreate(key, groupId)
-	defer decr()
-
-	x.AssertTruef(plist != nil, "plist is nil [%s] %d %s",
-		token, edge.ValueId, edge.Attr)
-	_, err := plist.AddMutation(ctx, edge)
-	if err != nil {
-		x.TraceError(ctx, x.Wrapf(err,
-			"Error adding/deleting %s for attr %s entity %d: %v",
-			token, edge.Attr, edge.Entity))
+	kes := make([]keyedEdge, 0, len(tokens))
+	for _, token := range tokens {
+		kes = append(kes, keyedEdge{
+			key:   x.IndexKey(edge.Attr, token),
+			group: groupId,
+			edge:  edge,
+		})
+		if edge.Op == task.DirectedEdge_SET {
+			tokensTable.Add(token)
+		}
+		indexLog.Printf("%s [%s] [%d] Term [%s]",
+			edge.Op, edge.Attr, edge.Entity, token)
 	}
-	indexLog.Printf("%s [%s] [%d] Term [%s]",
-		edge.Op, edge.Attr, edge.Entity, token)
-
+	return kes
 }
 
-func addReverseMutation(ctx context.Context, t *task.DirectedEdge) {
-	key := x.ReverseKey(t.Attr, t.ValueId)
-	groupId := group.BelongsTo(t.Attr)
-
-	plist, decr := GetOrCreate(key, groupId)
-	defer decr()
-
-	x.AssertTruef(plist != nil, "plist is nil [%s] %d %d",
-		t.Attr, t.Entity, t.ValueId)
+func addReverseMutation(t *task.DirectedEdge) keyedEdge {
 	edge := &task.DirectedEdge{
 		Entity:  t.ValueId,
 		ValueId: t.Entity,
@@ -175,28 +168,56 @@ func addReverseMutation(ctx context.Context, t *task.DirectedEdge) {
 		Label:   "rev",
 		Op:      t.Op,
 	}
+	reverseLog.Printf("%s [%s] [%d] [%d]", t.Op, t.Attr, t.Entity, t.ValueId)
+	return keyedEdge{
+		key:   x.ReverseKey(t.Attr, t.ValueId),
+		group: group.BelongsTo(t.Attr),
+		edge:  edge,
+	}
+}
 
-	_, err := plist.AddMutation(ctx, edge)
-	if err != nil {
+// applyKeyedEdges applies edges, which all have the same key, to the posting
+// list for that key. Errors are traced, but not returned, as the data edges
+// they were derived from have already been applied.
+func applyKeyedEdges(ctx context.Context, key []byte, groupId uint32,
+	edges []*task.DirectedEdge) {
+	plist, decr := GetOrCreate(key, groupId)
+	defer decr()
+
+	x.AssertTruef(plist != nil, "plist is nil [%s] %d %d",
+		edges[0].Attr, edges[0].Entity, edges[0].ValueId)
+	if _, err := plist.AddMutations(ctx, edges); err != nil {
 		x.TraceError(ctx, x.Wrapf(err,
-			"Error adding/deleting reverse edge for attr %s src %d dst %d",
-			t.Attr, t.Entity, t.ValueId))
+			"Error adding/deleting %d %s edges for attr %s",
+			len(edges), edges[0].Label, edges[0].Attr))
 	}
-	reverseLog.Printf("%s [%s] [%d] [%d]", t.Op, t.Attr, t.Entity, t.ValueId)
 }
 
 // AddMutationWithIndex is AddMutation with support for indexing. It also
 // supports reverse edges.
 func (l *List) AddMutationWithIndex(ctx context.Context, t *task.DirectedEdge) error {
+	// Keep the lock until the index is updated, so that concurrent mutations to
+	// this list update it in the same order as the list.
+	l.Lock()
+	defer l.Unlock()
+	kes, err := l.addMutationWithIndex(ctx, t)
+	for _, ke := range kes {
+		applyKeyedEdges(ctx, ke.key, ke.group, []*task.DirectedEdge{ke.edge})
+	}
+	return err
+}
+
+// addMutationWithIndex applies t to the list, and returns the index and reverse
+// edges which need to be applied to maintain the index.
+func (l *List) addMutationWithIndex(ctx context.Context,
+	t *task.DirectedEdge) ([]keyedEdge, error) {
 	x.AssertTruef(len(t.Attr) > 0,
 		"[%s] [%d] [%v] %d %d\n", t.Attr, t.Entity, t.Value, t.ValueId, t.Op)
+	l.AssertLock()
 
 	var val types.Val
 	var verr error
 
-	l.Lock()
-	defer l.Unlock()
-
 	doUpdateIndex := pstore != nil && (t.Value != nil) && schema.IsIndexed(t.Attr)
 	if doUpdateIndex {
 		// Check last posting for original value BEFORE any mutation actually happens.
@@ -204,28 +225,185 @@ func (l *List) AddMutationWithIndex(ctx context.Context, t *task.DirectedEdge) e
 	}
 	hasMutated, err := l.addMutation(ctx, t)
 	if err != nil {
-		return err
+		return nil, err
 	}
 	if !hasMutated {
-		return nil
+		return nil, nil
 	}
+
+	var kes []keyedEdge
 	if doUpdateIndex {
 		// Exact matches.
 		if verr == nil && val.Value != nil {
-			addIndexMutations(ctx, t, val, task.DirectedEdge_DEL)
+			kes = append(kes, addIndexMutations(ctx, t, val, task.DirectedEdge_DEL)...)
 		}
 		if t.Op == task.DirectedEdge_SET {
 			p := types.Val{
 				Tid:   types.TypeID(t.ValueType),
 				Value: t.Value,
 			}
-			addIndexMutations(ctx, t, p, task.DirectedEdge_SET)
+			kes = append(kes, addIndexMutations(ctx, t, p, task.DirectedEdge_SET)...)
 		}
 	}
 
 	if (pstore != nil) && (t.ValueId != 0) && schema.IsReversed(t.Attr) {
-		addReverseMutation(ctx, t)
+		kes = append(kes, addReverseMutation(t))
+	}
+	return kes, nil
+}
+
+// keyedEdges groups edges by the key of the posting list they apply to, keeping
+// the order in which edges were added for each key.
+type keyedEdges struct {
+	sync.Mutex
+	idx    map[string]int
+	keys   [][]byte
+	groups []uint32
+	edges  [][]*task.DirectedEdge
+}
+
+func newKeyedEdges() *keyedEdges {
+	return &keyedEdges{idx: make(map[string]int)}
+}
+
+func (ke *keyedEdges) Len() int { return len(ke.keys) }
+func (ke *keyedEdges) Less(i, j int) bool {
+	return bytes.Compare(ke.keys[i], ke.keys[j]) < 0
+}
+func (ke *keyedEdges) Swap(i, j int) {
+	ke.idx[string(ke.keys[i])], ke.idx[string(ke.keys[j])] = j, i
+	ke.keys[i], ke.keys[j] = ke.keys[j], ke.keys[i]
+	ke.groups[i], ke.groups[j] = ke.groups[j], ke.groups[i]
+	ke.edges[i], ke.edges[j] = ke.edges[j], ke.edges[i]
+}
+
+func (ke *keyedEdges) add(key []byte, groupId uint32, edge *task.DirectedEdge) {
+	i, has := ke.idx[string(key)]
+	if !has {
+		i = len(ke.keys)
+		ke.idx[string(key)] = i
+		ke.keys = append(ke.keys, key)
+		ke.groups = append(ke.groups, groupId)
+		ke.edges = append(ke.edges, nil)
+	}
+	ke.edges[i] = append(ke.edges[i], edge)
+}
+
+// parallelize calls f for every i in [0, n), using up to GOMAXPROCS goroutines.
+// It stops calling f after an error, and returns the first error encountered.
+func parallelize(n int, f func(i int) error) error {
+	workers := runtime.GOMAXPROCS(0)
+	if workers > n {
+		workers = n
+	}
+	if workers <= 1 {
+		for i := 0; i < n; i++ {
+			if err := f(i); err != nil {
+				return err
+			}
+		}
+		return nil
+	}
+
+	var next int64 = -1
+	var failed int32
+	errCh := make(chan error, workers)
+	for w := 0; w < workers; w++ {
+		go func() {
+			var rerr error
+			for atomic.LoadInt32(&failed) == 0 {
+				i := int(atomic.AddInt64(&next, 1))
+				if i >= n {
+					break
+				}
+				if err := f(i); err != nil {
+					atomic.StoreInt32(&failed, 1)
+					rerr = err
+				}
+			}
+			errCh <- rerr
+		}()
 	}
+	var rerr error
+	for w := 0; w < workers; w++ {
+		if err := <-errCh; err != nil && rerr == nil {
+			rerr = err
+		}
+	}
+	return rerr
+}
+
+// AddMutationsWithIndex applies all the edges of a proposal, along with the index
+// and reverse edges implied by them. Edges are grouped by the posting list they
+// apply to, so every list takes its lock once, and gets all its edges merged in
+// one pass. Lists are updated in parallel. The data edges are applied first, as
+// the index edges depend upon the values they replace.
+//
+// The data lists stay locked until their index and reverse edges are applied,
+// so that proposals changing the same entity update the index in the same order
+// as the data. They are locked in key order, so that proposals don't deadlock.
+// All the edges are checked before any is applied, so a proposal is either
+// applied in full, or not at all, on every replica.
+func AddMutationsWithIndex(ctx context.Context, edges []*task.DirectedEdge) error {
+	var groupId uint32
+	if rv, ok := ctx.Value("raft").(x.RaftValue); ok {
+		groupId = rv.Group
+	}
+
+	data := newKeyedEdges()
+	for _, edge := range edges {
+		x.AssertTruef(len(edge.Attr) > 0,
+			"[%s] [%d] [%v] %d %d\n", edge.Attr, edge.Entity, edge.Value, edge.ValueId, edge.Op)
+		data.add(x.DataKey(edge.Attr, edge.Entity), groupId, edge)
+	}
+	sort.Sort(data)
+
+	plists := make([]*List, len(data.keys))
+	for i, key := range data.keys {
+		var decr func()
+		plists[i], decr = GetOrCreate(key, groupId)
+		defer decr()
+	}
+	for _, plist := range plists {
+		plist.Lock()
+		defer plist.Unlock()
+	}
+	for i, plist := range plists {
+		if err := plist.checkMutations(ctx, data.edges[i]); err != nil {
+			x.Printf("Error while adding mutations to %d lists: %v", len(plists), err)
+			return err
+		}
+	}
+
+	derived := newKeyedEdges()
+	err := parallelize(len(plists), func(i int) error {
+		// Edges on the same list are applied in order, because the index edges
+		// for each depend on the value left by the previous one.
+		var kes []keyedEdge
+		for _, edge := range data.edges[i] {
+			ke, err := plists[i].addMutationWithIndex(ctx, edge)
+			if err != nil {
+				return err
+			}
+			kes = append(kes, ke...)
+		}
+
+		derived.Lock()
+		for _, ke := range kes {
+			derived.add(ke.key, ke.group, ke.edge)
+		}
+		derived.Unlock()
+		return nil
+	})
+	// The edges were checked above, so nothing should have failed.
+	x.AssertTruef(err == nil, "Error after checking mutations: %v", err)
+
+	// Derived edges with the same uid come from the same data list, so their
+	// order within each key doesn't depend on scheduling.
+	parallelize(len(derived.keys), func(i int) error {
+		applyKeyedEdges(ctx, derived.keys[i], derived.groups[i], derived.edges[i])
+		return nil
+	})
 	return nil
 }
 
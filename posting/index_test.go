@@ -1,10 +1,20 @@
 package posting
 
 import (
+	"context"
+	"io/ioutil"
+	"math/rand"
+	"os"
+	"runtime"
 	"testing"
 
+	"github.com/dgraph-io/dgraph/bench"
+	"github.com/dgraph-io/dgraph/group"
 	"github.com/dgraph-io/dgraph/schema"
+	"github.com/dgraph-io/dgraph/store"
+	"github.com/dgraph-io/dgraph/task"
 	"github.com/dgraph-io/dgraph/types"
+	"github.com/dgraph-io/dgraph/x"
 	"github.com/stretchr/testify/require"
 )
 
@@ -96,3 +106,192 @@ func TestTokensTableGetGeq(t *testing.T) {
 	require.EqualValues(t, "ccc", tt.GetPrevOrEqual("ccc"))
 	require.EqualValues(t, "ccc", tt.GetPrevOrEqual("cccc"))
 }
+
+func TestAddMutationsWithIndex(t *testing.T) {
+	schema.ParseBytes([]byte("scalar color:string @index\nscalar friend:uid @reverse"))
+	require.NoError(t, group.ParseGroupConfig(""))
+	// Make sure lists get updated in parallel.
+	defer runtime.GOMAXPROCS(runtime.GOMAXPROCS(4))
+	dir, err := ioutil.TempDir("", "storetest_")
+	require.NoError(t, err)
+	defer os.RemoveAll(dir)
+
+	ps, err := store.NewStore(dir)
+	require.NoError(t, err)
+	defer ps.Close()
+	Init(ps)
+
+	var edges []*task.DirectedEdge
+	for uid := uint64(1); uid <= 100; uid++ {
+		color := "red"
+		if uid%2 == 0 {
+			color = "blue"
+		}
+		edges = append(edges, &task.DirectedEdge{
+			Entity: uid, Attr: "color", Value: []byte(color), Op: task.DirectedEdge_SET,
+		}, &task.DirectedEdge{
+			Entity: uid, Attr: "friend", ValueId: 1000, Op: task.DirectedEdge_SET,
+		})
+	}
+	// Move uid 1 from red to blue in the same batch.
+	edges = append(edges, &task.DirectedEdge{
+		Entity: 1, Attr: "color", Value: []byte("blue"), Op: task.DirectedEdge_SET,
+	})
+	require.NoError(t, AddMutationsWithIndex(context.Background(), edges))
+
+	count := func(key []byte) int {
+		l, decr := GetOrCreate(key, 0)
+		defer decr()
+		return l.Length(0)
+	}
+	require.Equal(t, 49, count(x.IndexKey("color", "red")))
+	require.Equal(t, 51, count(x.IndexKey("color", "blue")))
+	require.Equal(t, 100, count(x.ReverseKey("friend", 1000)))
+	require.Equal(t, 1, count(x.DataKey("friend", 7)))
+}
+
+func TestAddMutationsWithIndexConcurrent(t *testing.T) {
+	schema.ParseBytes([]byte("scalar color:string @index"))
+	require.NoError(t, group.ParseGroupConfig(""))
+	defer runtime.GOMAXPROCS(runtime.GOMAXPROCS(4))
+	dir, err := ioutil.TempDir("", "storetest_")
+	require.NoError(t, err)
+	defer os.RemoveAll(dir)
+
+	ps, err := store.NewStore(dir)
+	require.NoError(t, err)
+	defer ps.Close()
+	Init(ps)
+
+	colors := []string{"red", "blue", "green", "amber", "white", "black"}
+	hasUid := func(key []byte, uid uint64) bool {
+		l, decr := GetOrCreate(key, 0)
+		defer decr()
+		for _, u := range l.Uids(ListOptions{}).Uids {
+			if u == uid {
+				return true
+			}
+		}
+		return false
+	}
+	for round := 0; round < 50; round++ {
+		// Every proposal changes the color of uid 1, along with one other entity.
+		errCh := make(chan error, len(colors))
+		for i, color := range colors {
+			go func(i int, color string) {
+				errCh <- AddMutationsWithIndex(context.Background(), []*task.DirectedEdge{
+					{Entity: 1, Attr: "color", Value: []byte(color), Op: task.DirectedEdge_SET},
+					{Entity: uint64(10 + i), Attr: "color", Value: []byte(color),
+						Op: task.DirectedEdge_SET},
+				})
+			}(i, color)
+		}
+		for range colors {
+			require.NoError(t, <-errCh)
+		}
+
+		l, decr := GetOrCreate(x.DataKey("color", 1), 0)
+		val, err := l.Value()
+		decr()
+		require.NoError(t, err)
+		for _, color := range colors {
+			require.Equal(t, color == string(val.Value.([]byte)),
+				hasUid(x.IndexKey("color", color), 1), "round %d color %s", round, color)
+		}
+	}
+}
+
+func TestAddMutationsWithIndexInvalid(t *testing.T) {
+	schema.ParseBytes([]byte("scalar color:string @index"))
+	require.NoError(t, group.ParseGroupConfig(""))
+	dir, err := ioutil.TempDir("", "storetest_")
+	require.NoError(t, err)
+	defer os.RemoveAll(dir)
+
+	ps, err := store.NewStore(dir)
+	require.NoError(t, err)
+	defer ps.Close()
+	Init(ps)
+
+	// The second edge is invalid, so neither is applied.
+	err = AddMutationsWithIndex(context.Background(), []*task.DirectedEdge{
+		{Entity: 2, Attr: "color", Value: []byte("violet"), Op: task.DirectedEdge_SET},
+		{Entity: 3, Attr: "friend", Op: task.DirectedEdge_SET},
+	})
+	require.Error(t, err)
+	count := func(key []byte) int {
+		l, decr := GetOrCreate(key, 0)
+		defer decr()
+		return l.Length(0)
+	}
+	require.Equal(t, 0, count(x.DataKey("color", 2)))
+	require.Equal(t, 0, count(x.IndexKey("color", "violet")))
+}
+
+const benchSchema = `
+scalar friend:uid @reverse
+scalar name:string @index
+scalar age:int @index
+scalar loc:geo @index
+`
+
+// benchMutations returns the edges of the synthetic graph for benchSchema,
+// shuffled, so that batches mix data, index and reverse edges.
+func benchMutations(g *bench.Graph) []*task.DirectedEdge {
+	var edges []*task.DirectedEdge
+	edges = append(edges, g.UidEdges("friend")...)
+	edges = append(edges, g.StringEdges("name")...)
+	edges = append(edges, g.IntEdges("age", 100)...)
+	edges = append(edges, g.GeoEdges("loc")...)
+	r := rand.New(rand.NewSource(g.Seed))
+	for i := len(edges) - 1; i > 0; i-- {
+		j := r.Intn(i + 1)
+		edges[i], edges[j] = edges[j], edges[i]
+	}
+	return edges
+}
+
+func BenchmarkAddMutationsWithIndex(b *testing.B) {
+	schema.ParseBytes([]byte(benchSchema))
+	if err := group.ParseGroupConfig(""); err != nil {
+		b.Fatal(err)
+	}
+	dir, err := ioutil.TempDir("", "storetest_")
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer os.RemoveAll(dir)
+	ps, err := store.NewStore(dir)
+	if err != nil {
+		b.Fatal(err)
+	}
+	Init(ps)
+
+	g := bench.NewGraph(bench.DefaultConfig)
+	edges := benchMutations(g)
+	const batchSize = 1000
+	ctx := context.Background()
+	rec := bench.NewRecorder("posting/mutations/batch=1000", b.N)
+	batch := make([]*task.DirectedEdge, batchSize)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		b.StopTimer()
+		// Once all the edges are applied, move on to new entities, so that the
+		// mutations aren't no-ops.
+		for j := range batch {
+			k := i*batchSize + j
+			e := *edges[k%len(edges)]
+			e.Entity += uint64(k/len(edges)) * uint64(g.Nodes)
+			batch[j] = &e
+		}
+		b.StartTimer()
+
+		rec.Start()
+		if err := AddMutationsWithIndex(ctx, batch); err != nil {
+			b.Fatal(err)
+		}
+		rec.Stop()
+	}
+	b.StopTimer()
+	rec.Report(b)
+}
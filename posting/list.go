@@ -79,6 +79,8 @@ func (l *List) decr() {
 	if val > 0 {
 		return
 	}
+	// Nobody holds a reference anymore, so release the off heap postings.
+	(*packedList)(atomic.SwapPointer(&l.pbuffer, nil)).free()
 	listPool.Put(l)
 }
 
@@ -156,15 +158,16 @@ func (l *List) WaitForCommit() {
 	l.Wait()
 }
 
+// PostingList returns a copy of the immutable layer of the list.
 func (l *List) PostingList() *types.PostingList {
 	l.RLock()
 	defer l.RUnlock()
-	return l.getPostingList(0)
+	return l.getPostingList(0).postingList()
 }
 
 // getPostingList tries to get posting list from l.pbuffer. If it is nil, then
 // we query RocksDB. There is no need for lock acquisition here.
-func (l *List) getPostingList(loop int) *types.PostingList {
+func (l *List) getPostingList(loop int) *packedList {
 	if loop >= 10 {
 		x.Fatalf("This is over the 10th loop: %v", loop)
 	}
@@ -173,23 +176,25 @@ func (l *List) getPostingList(loop int) *types.PostingList {
 	l.Wait()
 
 	pb := atomic.LoadPointer(&l.pbuffer)
-	plist := (*types.PostingList)(pb)
+	pk := (*packedList)(pb)
 
-	if plist == nil {
+	if pk == nil {
 		x.AssertTrue(l.pstore != nil)
-		plist = new(types.PostingList)
+		plist := new(types.PostingList)
 
 		if slice, err := l.pstore.Get(l.key); err == nil && slice != nil {
 			x.Checkf(plist.Unmarshal(slice.Data()), "Unable to Unmarshal PostingList from store")
 			slice.Free()
 		}
-		if atomic.CompareAndSwapPointer(&l.pbuffer, pb, unsafe.Pointer(plist)) {
-			return plist
+		pk = packPostingList(plist, l.ghash)
+		if atomic.CompareAndSwapPointer(&l.pbuffer, pb, unsafe.Pointer(pk)) {
+			return pk
 		}
+		pk.free()
 		// Someone else replaced the pointer in the meantime. Retry recursively.
 		return l.getPostingList(loop + 1)
 	}
-	return plist
+	return pk
 }
 
 // SetForDeletion will mark this List to be deleted, so no more mutations can be applied to this.
@@ -211,9 +216,42 @@ func (l *List) updateMutationLayer(mpost *types.Posting) bool {
 
 	// This block handles the case where mpost.UID is found in mutation layer.
 	if midx < len(l.mlayer) && l.mlayer[midx].Uid == mpost.Uid {
-		// mp is the posting found in mlayer.
-		oldPost := l.mlayer[midx]
+		mp, mutated := l.mergePosting(l.mlayer[midx], mpost)
+		if mp == nil {
+			// Undo old post.
+			copy(l.mlayer[midx:], l.mlayer[midx+1:])
+			l.mlayer[len(l.mlayer)-1] = nil
+			l.mlayer = l.mlayer[:len(l.mlayer)-1]
+		} else {
+			l.mlayer[midx] = mp
+		}
+		return mutated
+	}
 
+	mp, mutated := l.mergePosting(nil, mpost)
+	if !mutated {
+		return false
+	}
+	// Doesn't match what we already have in immutable layer. So, add to mutable layer.
+	if midx >= len(l.mlayer) {
+		// Add it at the end.
+		l.mlayer = append(l.mlayer, mp)
+		return true
+	}
+
+	// Otherwise, add it where midx is pointing to.
+	l.mlayer = append(l.mlayer, nil)
+	copy(l.mlayer[midx+1:], l.mlayer[midx:])
+	l.mlayer[midx] = mp
+	return true
+}
+
+// mergePosting applies mpost on top of oldPost, which is the posting with the
+// same uid in the mutable layer, or nil if there's none. It returns what should
+// be in the mutable layer for this uid after that, nil meaning nothing, and
+// whether anything changed.
+func (l *List) mergePosting(oldPost, mpost *types.Posting) (*types.Posting, bool) {
+	if oldPost != nil {
 		// Note that mpost.Op is either Set or Del, whereas oldPost.Op can be
 		// either Set or Del or Add.
 		msame := samePosting(oldPost, mpost)
@@ -222,12 +260,12 @@ func (l *List) updateMutationLayer(mpost *types.Posting) bool {
 			// ops are similar, then we do nothing. Note that Add and Set are
 			// considered similar, and the second clause is true also when
 			// mpost.Op==Add and oldPost.Op==Set.
-			return false
+			return oldPost, false
 		}
 
 		if !msame && mpost.Op == Del {
 			// Invalid Del as contents do not match.
-			return false
+			return oldPost, false
 		}
 
 		// Here are the remaining cases.
@@ -239,38 +277,31 @@ func (l *List) updateMutationLayer(mpost *types.Posting) bool {
 		// Add, Set: Replace with new post. Need to set mpost.Op to Add.
 		if oldPost.Op == Add {
 			if mpost.Op == Del {
-				// Undo old post.
-				copy(l.mlayer[midx:], l.mlayer[midx+1:])
-				l.mlayer[len(l.mlayer)-1] = nil
-				l.mlayer = l.mlayer[:len(l.mlayer)-1]
-				return true
+				return nil, true
 			}
 			// Add followed by Set is considered an Add. Hence, mutate mpost.Op.
 			mpost.Op = Add
 		}
-		l.mlayer[midx] = mpost
-		return true
+		return mpost, true
 	}
 
 	// Didn't find it in mutable layer. Now check the immutable layer.
 	pl := l.getPostingList(0)
-	pidx := sort.Search(len(pl.Postings), func(idx int) bool {
-		p := pl.Postings[idx]
-		return mpost.Uid <= p.Uid
-	})
+	pidx := pl.search(mpost.Uid)
 
 	var uidFound, psame bool
-	if pidx < len(pl.Postings) {
-		p := pl.Postings[pidx]
-		uidFound = mpost.Uid == p.Uid
+	if pidx < pl.length() {
+		uidFound = mpost.Uid == pl.uid(pidx)
 		if uidFound {
-			psame = samePosting(p, mpost)
+			var p types.Posting
+			pl.posting(pidx, &p)
+			psame = samePosting(&p, mpost)
 		}
 	}
 
 	if mpost.Op == Set {
 		if psame {
-			return false
+			return nil, false
 		}
 		if !uidFound {
 			// Posting not found in PL. This is considered an Add operation.
@@ -278,21 +309,43 @@ func (l *List) updateMutationLayer(mpost *types.Posting) bool {
 		}
 	} else if !psame { // mpost.Op==Del
 		// Either we fail to find UID in immutable PL or contents don't match.
-		return false
+		return nil, false
 	}
+	return mpost, true
+}
 
-	// Doesn't match what we already have in immutable layer. So, add to mutable layer.
-	if midx >= len(l.mlayer) {
-		// Add it at the end.
-		l.mlayer = append(l.mlayer, mpost)
-		return true
+// mergeMutationLayer applies the postings, sorted by uid, to the mutable layer
+// in a single pass over it. Postings with the same uid are applied in order.
+// It returns the number of postings which changed the list.
+func (l *List) mergeMutationLayer(mposts []*types.Posting) int {
+	l.AssertLock()
+	var mutated int
+	out := make([]*types.Posting, 0, len(l.mlayer)+len(mposts))
+	midx := 0
+	for i := 0; i < len(mposts); {
+		uid := mposts[i].Uid
+		for midx < len(l.mlayer) && l.mlayer[midx].Uid < uid {
+			out = append(out, l.mlayer[midx])
+			midx++
+		}
+		var cur *types.Posting
+		if midx < len(l.mlayer) && l.mlayer[midx].Uid == uid {
+			cur = l.mlayer[midx]
+			midx++
+		}
+		for ; i < len(mposts) && mposts[i].Uid == uid; i++ {
+			x.AssertTrue(mposts[i].Op == Set || mposts[i].Op == Del)
+			var changed bool
+			if cur, changed = l.mergePosting(cur, mposts[i]); changed {
+				mutated++
+			}
+		}
+		if cur != nil {
+			out = append(out, cur)
+		}
 	}
-
-	// Otherwise, add it where midx is pointing to.
-	l.mlayer = append(l.mlayer, nil)
-	copy(l.mlayer[midx+1:], l.mlayer[midx:])
-	l.mlayer[midx] = mpost
-	return true
+	l.mlayer = append(out, l.mlayer[midx:]...)
+	return mutated
 }
 
 // AddMutation adds mutation to mutation layers. Note that it does not write
@@ -343,12 +396,81 @@ func (l *List) addMutation(ctx context.Context, t *task.DirectedEdge) (bool, err
 	return hasMutated, nil
 }
 
+// checkMutations returns the error addMutation would return for any of the
+// edges, without applying them.
+func (l *List) checkMutations(ctx context.Context, edges []*task.DirectedEdge) error {
+	l.AssertLock()
+	if l.deleteMe == 1 {
+		x.TraceError(ctx, x.Errorf("DELETEME set to true. Temporary error."))
+		return ErrRetry
+	}
+	for _, t := range edges {
+		if len(t.Value) == 0 && t.ValueId == 0 {
+			err := x.Errorf("ValueId cannot be zero")
+			x.TraceError(ctx, err)
+			return err
+		}
+	}
+	return nil
+}
+
+// AddMutations is like AddMutation for many edges on this list at once. The
+// edges are merged into the mutation layer together, under a single lock. Edges
+// with the same uid are applied in the order given. Returns the number of edges
+// which mutated the list.
+func (l *List) AddMutations(ctx context.Context, edges []*task.DirectedEdge) (int, error) {
+	l.Lock()
+	defer l.Unlock()
+	return l.addMutations(ctx, edges)
+}
+
+func (l *List) addMutations(ctx context.Context, edges []*task.DirectedEdge) (int, error) {
+	l.AssertLock()
+	if l.deleteMe == 1 {
+		x.TraceError(ctx, x.Errorf("DELETEME set to true. Temporary error."))
+		return 0, ErrRetry
+	}
+
+	mposts := make([]*types.Posting, 0, len(edges))
+	for _, t := range edges {
+		// See addMutation.
+		if !bytes.Equal(t.Value, nil) {
+			t.ValueId = math.MaxUint64
+		}
+		if t.ValueId == 0 {
+			err := x.Errorf("ValueId cannot be zero")
+			x.TraceError(ctx, err)
+			return 0, err
+		}
+		mposts = append(mposts, newPosting(t))
+	}
+	sort.Stable(ByUid(mposts))
+
+	mutated := l.mergeMutationLayer(mposts)
+	if mutated > 0 {
+		// All the edges belong to the same proposal, so mark it once.
+		if rv, ok := ctx.Value("raft").(x.RaftValue); ok {
+			l.water.Ch <- x.Mark{Index: rv.Index}
+			l.pending = append(l.pending, rv.Index)
+		}
+		if dirtyChan != nil {
+			dirtyChan <- l.ghash
+		}
+	}
+	return mutated, nil
+}
+
 // Iterate will allow you to iterate over this Posting List, while having acquired a read lock.
 // So, please keep this iteration cheap, otherwise mutations would get stuck.
 // The iteration will start after the provided UID. The results would not include this UID.
 // The function will loop until either the Posting List is fully iterated, or you return a false
 // in the provided function, which will indicate to the function to break out of the iteration.
 //
+// The posting passed to f, along with its Value and Label, is only valid until f
+// returns. Postings from the immutable layer are decoded into a reused Posting,
+// and their Value and Label point into a buffer outside the Go heap, which is
+// freed once the list is committed or evicted. Copy anything f needs to keep.
+//
 // 	pl.Iterate(func(p *types.Posting) bool {
 //    // Use posting p
 //    return true  // to continue iteration.
@@ -366,21 +488,22 @@ func (l *List) iterate(afterUid uint64, f func(obj *types.Posting) bool) {
 	pl := l.getPostingList(0)
 
 	if afterUid > 0 {
-		pidx = sort.Search(len(pl.Postings), func(idx int) bool {
-			p := pl.Postings[idx]
-			return afterUid < p.Uid
-		})
+		pidx = pl.searchAfter(afterUid)
 		midx = sort.Search(len(l.mlayer), func(idx int) bool {
 			mp := l.mlayer[idx]
 			return afterUid < mp.Uid
 		})
 	}
 
+	// pp points to scratch for postings from the immutable layer, so they don't
+	// need to be allocated on the heap.
 	var mp, pp *types.Posting
+	var scratch types.Posting
 	cont := true
 	for cont {
-		if pidx < len(pl.Postings) {
-			pp = pl.Postings[pidx]
+		if pidx < pl.length() {
+			pl.posting(pidx, &scratch)
+			pp = &scratch
 		} else {
 			pp = emptyPosting
 		}
@@ -422,17 +545,14 @@ func (l *List) Length(afterUid uint64) int {
 	pl := l.getPostingList(0)
 
 	if afterUid > 0 {
-		pidx = sort.Search(len(pl.Postings), func(idx int) bool {
-			p := pl.Postings[idx]
-			return afterUid < p.Uid
-		})
+		pidx = pl.searchAfter(afterUid)
 		midx = sort.Search(len(l.mlayer), func(idx int) bool {
 			mp := l.mlayer[idx]
 			return afterUid < mp.Uid
 		})
 	}
 
-	count := len(pl.Postings) - pidx
+	count := pl.length() - pidx
 	for _, p := range l.mlayer[midx:] {
 		if p.Op == Add {
 			count++
@@ -466,10 +586,15 @@ func (l *List) CommitIfDirty(ctx context.Context) (committed bool, err error) {
 		h.Write([]byte(p.Label))
 		count++
 
-		// I think it's okay to take the pointer from the iterator, because we have a lock
-		// over List; which won't be released until final has been marshalled. Thus, the
-		// underlying data wouldn't be changed.
-		final.Postings = append(final.Postings, p)
+		// The iterator reuses p for postings from the immutable layer, so copy it.
+		// Its value can still point to the off heap buffer, which won't be freed
+		// until final has been marshalled.
+		pp := new(types.Posting)
+		*pp = *p
+		// Op only means something in the mutable layer. Clearing it lets postings
+		// with just a uid take no space in the blob of the packed list.
+		pp.Op = 0
+		final.Postings = append(final.Postings, pp)
 		return true
 	})
 	final.Checksum = h.Sum(nil)
@@ -488,7 +613,7 @@ func (l *List) CommitIfDirty(ctx context.Context) (committed bool, err error) {
 
 	// Now reset the mutation variables.
 	l.pending = make([]uint64, 0, 3)
-	atomic.StorePointer(&l.pbuffer, nil) // Make prev buffer eligible for GC.
+	(*packedList)(atomic.SwapPointer(&l.pbuffer, nil)).free()
 	l.mlayer = l.mlayer[:0]
 	l.lastCompact = time.Now()
 	return true, nil
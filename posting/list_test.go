@@ -28,6 +28,7 @@ import (
 
 	"github.com/stretchr/testify/require"
 
+	"github.com/dgraph-io/dgraph/bench"
 	"github.com/dgraph-io/dgraph/store"
 	"github.com/dgraph-io/dgraph/task"
 	"github.com/dgraph-io/dgraph/types"
@@ -270,6 +271,32 @@ func TestAddMutation_jchiu2(t *testing.T) {
 	checkValue(t, ol, "newcars")
 }
 
+func TestCommitPacksUidPostings(t *testing.T) {
+	key := x.DataKey("friend", 10)
+	dir, err := ioutil.TempDir("", "storetest_")
+	require.NoError(t, err)
+	defer os.RemoveAll(dir)
+
+	ps, err := store.NewStore(dir)
+	require.NoError(t, err)
+	Init(ps)
+	ol := getNew(key, ps)
+
+	for uid := uint64(1); uid <= 10; uid++ {
+		addMutation(t, ol, &task.DirectedEdge{ValueId: uid}, Set)
+	}
+	merged, err := ol.CommitIfDirty(context.Background())
+	require.NoError(t, err)
+	require.True(t, merged)
+
+	// Postings with just a uid take no space in the blob.
+	ol.RLock()
+	defer ol.RUnlock()
+	pk := ol.getPostingList(0)
+	require.Equal(t, 10, pk.length())
+	require.Equal(t, pk.blob, len(pk.buf))
+}
+
 func TestAddMutation_jchiu3(t *testing.T) {
 	key := x.DataKey("value", 10)
 	dir, err := ioutil.TempDir("", "storetest_")
@@ -788,6 +815,61 @@ func TestAfterUIDCountWithCommit(t *testing.T) {
 	require.EqualValues(t, 0, ol.Length(300))
 }
 
+func TestAddMutations_batch(t *testing.T) {
+	dir, err := ioutil.TempDir("", "storetest_")
+	require.NoError(t, err)
+	defer os.RemoveAll(dir)
+
+	ps, err := store.NewStore(dir)
+	require.NoError(t, err)
+	Init(ps)
+	ctx := context.Background()
+
+	// Apply the same edges one at a time to ol, and as one batch to bl.
+	ol := getNew(x.DataKey("batch", 1), ps)
+	bl := getNew(x.DataKey("batch", 2), ps)
+	for uid := uint64(1); uid <= 50; uid += 2 {
+		edge := &task.DirectedEdge{ValueId: uid, Label: "base", Op: task.DirectedEdge_SET}
+		_, err := ol.AddMutation(ctx, edge)
+		require.NoError(t, err)
+		_, err = bl.AddMutation(ctx, edge)
+		require.NoError(t, err)
+	}
+	_, err = ol.CommitIfDirty(ctx)
+	require.NoError(t, err)
+	_, err = bl.CommitIfDirty(ctx)
+	require.NoError(t, err)
+
+	r := rand.New(rand.NewSource(1))
+	var edges []*task.DirectedEdge
+	for i := 0; i < 500; i++ {
+		edge := &task.DirectedEdge{
+			ValueId: uint64(r.Intn(60) + 1),
+			Label:   []string{"base", "a", "b"}[r.Intn(3)],
+			Op:      task.DirectedEdge_SET,
+		}
+		if r.Intn(3) == 0 {
+			edge.Op = task.DirectedEdge_DEL
+		}
+		edges = append(edges, edge)
+	}
+
+	var mutated int
+	for _, edge := range edges {
+		e := *edge
+		ok, err := ol.AddMutation(ctx, &e)
+		require.NoError(t, err)
+		if ok {
+			mutated++
+		}
+	}
+	n, err := bl.AddMutations(ctx, edges)
+	require.NoError(t, err)
+
+	require.Equal(t, mutated, n)
+	require.Equal(t, ol.mlayer, bl.mlayer)
+}
+
 func TestMain(m *testing.M) {
 	x.Init()
 	os.Exit(m.Run())
@@ -828,3 +910,94 @@ func BenchmarkAddMutations(b *testing.B) {
 		}
 	}
 }
+
+// benchEdges returns the edges of the synthetic graph for attr, grouped by
+// entity.
+func benchEdges(g *bench.Graph, attr string) [][]*task.DirectedEdge {
+	out := make([][]*task.DirectedEdge, g.Nodes)
+	for _, e := range g.UidEdges(attr) {
+		out[e.Entity-1] = append(out[e.Entity-1], e)
+	}
+	return out
+}
+
+// BenchmarkCommitIfDirty measures committing lists of the synthetic graph:
+// the checksum and marshal, and handing the list over to the batch writer.
+func BenchmarkCommitIfDirty(b *testing.B) {
+	dir, err := ioutil.TempDir("", "storetest_")
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer os.RemoveAll(dir)
+	ps, err := store.NewStore(dir)
+	if err != nil {
+		b.Fatal(err)
+	}
+	Init(ps)
+
+	g := bench.NewGraph(bench.DefaultConfig)
+	adj := benchEdges(g, "friend")
+	ctx := context.Background()
+	rec := bench.NewRecorder("posting/commit", b.N)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		b.StopTimer()
+		// Use a new entity each time, so that the list is always dirty.
+		l, decr := GetOrCreate(x.DataKey("friend", uint64(i)+1), 0)
+		if _, err := l.AddMutations(ctx, adj[i%len(adj)]); err != nil {
+			b.Fatal(err)
+		}
+		b.StartTimer()
+
+		rec.Start()
+		if _, err := l.CommitIfDirty(ctx); err != nil {
+			b.Fatal(err)
+		}
+		rec.Stop()
+		decr()
+	}
+	b.StopTimer()
+	rec.Report(b)
+}
+
+// BenchmarkUids measures reading committed lists of the synthetic graph,
+// intersected with a list of 1000 uids.
+func BenchmarkUids(b *testing.B) {
+	dir, err := ioutil.TempDir("", "storetest_")
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer os.RemoveAll(dir)
+	ps, err := store.NewStore(dir)
+	if err != nil {
+		b.Fatal(err)
+	}
+	Init(ps)
+
+	g := bench.NewGraph(bench.DefaultConfig)
+	ctx := context.Background()
+	for i, edges := range benchEdges(g, "friend") {
+		l, decr := GetOrCreate(x.DataKey("friend", uint64(i)+1), 0)
+		if _, err := l.AddMutations(ctx, edges); err != nil {
+			b.Fatal(err)
+		}
+		if _, err := l.CommitIfDirty(ctx); err != nil {
+			b.Fatal(err)
+		}
+		decr()
+	}
+
+	opt := ListOptions{Intersect: &task.List{Uids: g.Uids("intersect", 1000)}}
+	r := rand.New(rand.NewSource(1))
+	rec := bench.NewRecorder("posting/uids", b.N)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		rec.Start()
+		l, decr := GetOrCreate(x.DataKey("friend", uint64(r.Intn(g.Nodes))+1), 0)
+		l.Uids(opt)
+		decr()
+		rec.Stop()
+	}
+	b.StopTimer()
+	rec.Report(b)
+}
@@ -145,6 +145,8 @@ func aggressivelyEvict() {
 	// Forces garbage collection followed by returning as much memory to the OS
 	// as possible.
 	debug.FreeOSMemory()
+	// Evicted lists have released their postings to the arenas. Return them too.
+	purgeArenas()
 
 	megs = getMemUsage()
 	log.Printf("EVICT DONE! Memory usage after calling GC. Allocated MB: %v", megs)
@@ -251,7 +253,8 @@ func periodicCommit() {
 func getMemUsage() int {
 	var ms runtime.MemStats
 	runtime.ReadMemStats(&ms)
-	megs := ms.Alloc / (1 << 20)
+	// Posting lists live off the Go heap, so add them in.
+	megs := (ms.Alloc + uint64(atomic.LoadInt64(&offHeapBytes))) / (1 << 20)
 	return int(megs)
 
 	// Sticking to ms.Alloc temoprarily.
@@ -0,0 +1,226 @@
+/*
+ * Copyright 2016 DGraph Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * 		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package posting
+
+import (
+	"encoding/binary"
+	"expvar"
+	"reflect"
+	"sort"
+	"sync"
+	"sync/atomic"
+	"unsafe"
+
+	"github.com/dgraph-io/dgraph/types"
+)
+
+// packedList is the immutable layer of a posting list, laid out in a single
+// buffer allocated outside of the Go heap. The GC never scans the postings, and
+// the buffer is freed explicitly once the list is committed or evicted.
+//
+// The buffer contains:
+//	n        uint32 number of postings
+//	cklen    uint32 length of the checksum
+//	checksum [cklen]byte
+//	uids     [n]uint64, sorted
+//	offsets  [n+1]uint32, into blob
+//	blob     everything else for posting i, in blob[offsets[i]:offsets[i+1]]
+//
+// A posting with only a uid takes up no space in blob. Otherwise, its entry is
+// the uvarints val_type, op, commit and len(label), then label, then value.
+type packedList struct {
+	buf  []byte
+	n    int
+	uids int // Offset of uids in buf.
+	offs int // Offset of offsets in buf.
+	blob int // Offset of blob in buf.
+}
+
+var (
+	emptyPacked = &packedList{}
+
+	offHeapBytes int64
+	offHeapLists int64
+
+	initArenasOnce sync.Once
+)
+
+func init() {
+	expvar.Publish("posting_offheap", expvar.Func(func() interface{} {
+		return map[string]interface{}{
+			"bytes":  atomic.LoadInt64(&offHeapBytes),
+			"lists":  atomic.LoadInt64(&offHeapLists),
+			"arenas": arenaStats(),
+		}
+	}))
+}
+
+func entrySize(p *types.Posting) int {
+	if p.ValType == 0 && p.Op == 0 && p.Commit == 0 && len(p.Label) == 0 &&
+		len(p.Value) == 0 {
+		return 0
+	}
+	return uvarintSize(uint64(p.ValType)) + uvarintSize(uint64(p.Op)) +
+		uvarintSize(p.Commit) + uvarintSize(uint64(len(p.Label))) +
+		len(p.Label) + len(p.Value)
+}
+
+func uvarintSize(v uint64) int {
+	n := 1
+	for v >= 0x80 {
+		v >>= 7
+		n++
+	}
+	return n
+}
+
+// packPostingList copies pl into a new packedList, allocated from the arena of
+// the given shard.
+func packPostingList(pl *types.PostingList, shard uint64) *packedList {
+	n := len(pl.Postings)
+	if n == 0 && len(pl.Checksum) == 0 {
+		return emptyPacked
+	}
+
+	// One arena per lhmap shard.
+	initArenasOnce.Do(func() { initArenas(*lhmapNumShards) })
+
+	var blobSize int
+	for _, p := range pl.Postings {
+		blobSize += entrySize(p)
+	}
+	pk := &packedList{n: n}
+	pk.uids = 8 + len(pl.Checksum)
+	pk.offs = pk.uids + 8*n
+	pk.blob = pk.offs + 4*(n+1)
+	size := pk.blob + blobSize
+
+	data := arenaAlloc(shard, size)
+	h := (*reflect.SliceHeader)(unsafe.Pointer(&pk.buf))
+	h.Data, h.Len, h.Cap = uintptr(data), size, size
+	atomic.AddInt64(&offHeapBytes, int64(size))
+	atomic.AddInt64(&offHeapLists, 1)
+
+	buf := pk.buf
+	binary.LittleEndian.PutUint32(buf[0:4], uint32(n))
+	binary.LittleEndian.PutUint32(buf[4:8], uint32(len(pl.Checksum)))
+	copy(buf[8:], pl.Checksum)
+
+	off := 0
+	for i, p := range pl.Postings {
+		binary.LittleEndian.PutUint64(buf[pk.uids+8*i:], p.Uid)
+		binary.LittleEndian.PutUint32(buf[pk.offs+4*i:], uint32(off))
+		if entrySize(p) == 0 {
+			continue
+		}
+		e := buf[pk.blob+off:]
+		k := binary.PutUvarint(e, uint64(p.ValType))
+		k += binary.PutUvarint(e[k:], uint64(p.Op))
+		k += binary.PutUvarint(e[k:], p.Commit)
+		k += binary.PutUvarint(e[k:], uint64(len(p.Label)))
+		k += copy(e[k:], p.Label)
+		k += copy(e[k:], p.Value)
+		off += k
+	}
+	binary.LittleEndian.PutUint32(buf[pk.offs+4*n:], uint32(off))
+	return pk
+}
+
+// free releases the buffer. The packedList can't be used after this.
+func (pk *packedList) free() {
+	if pk == nil || pk.buf == nil {
+		return
+	}
+	atomic.AddInt64(&offHeapBytes, -int64(len(pk.buf)))
+	atomic.AddInt64(&offHeapLists, -1)
+	arenaFree(unsafe.Pointer(&pk.buf[0]))
+	pk.buf = nil
+}
+
+func (pk *packedList) length() int { return pk.n }
+
+func (pk *packedList) uid(i int) uint64 {
+	return binary.LittleEndian.Uint64(pk.buf[pk.uids+8*i:])
+}
+
+// search returns the index of the first posting with uid >= the given uid.
+func (pk *packedList) search(uid uint64) int {
+	return sort.Search(pk.n, func(i int) bool { return uid <= pk.uid(i) })
+}
+
+// searchAfter returns the index of the first posting with uid > the given uid.
+func (pk *packedList) searchAfter(uid uint64) int {
+	return sort.Search(pk.n, func(i int) bool { return uid < pk.uid(i) })
+}
+
+// posting fills p with the i-th posting. The value and label of p point into
+// the buffer, so they're only valid until it gets freed.
+func (pk *packedList) posting(i int, p *types.Posting) {
+	*p = types.Posting{Uid: pk.uid(i)}
+	start := binary.LittleEndian.Uint32(pk.buf[pk.offs+4*i:])
+	end := binary.LittleEndian.Uint32(pk.buf[pk.offs+4*i+4:])
+	if start == end {
+		return
+	}
+	e := pk.buf[pk.blob+int(start) : pk.blob+int(end)]
+	v, k := binary.Uvarint(e)
+	p.ValType = types.Posting_ValType(v)
+	e = e[k:]
+	v, k = binary.Uvarint(e)
+	p.Op = uint32(v)
+	e = e[k:]
+	p.Commit, k = binary.Uvarint(e)
+	e = e[k:]
+	v, k = binary.Uvarint(e)
+	e = e[k:]
+	if v > 0 {
+		label := e[:v]
+		sh := (*reflect.StringHeader)(unsafe.Pointer(&p.Label))
+		sh.Data, sh.Len = uintptr(unsafe.Pointer(&label[0])), len(label)
+	}
+	if len(e) > int(v) {
+		p.Value = e[v:]
+	}
+}
+
+func (pk *packedList) checksum() []byte {
+	if pk.n == 0 && pk.buf == nil {
+		return nil
+	}
+	cklen := binary.LittleEndian.Uint32(pk.buf[4:8])
+	return pk.buf[8 : 8+cklen]
+}
+
+// postingList returns a copy of the list on the Go heap.
+func (pk *packedList) postingList() *types.PostingList {
+	pl := &types.PostingList{
+		Postings: make([]*types.Posting, pk.n),
+	}
+	if ck := pk.checksum(); len(ck) > 0 {
+		pl.Checksum = append([]byte{}, ck...)
+	}
+	for i := range pl.Postings {
+		var p types.Posting
+		pk.posting(i, &p)
+		if len(p.Value) > 0 {
+			p.Value = append([]byte{}, p.Value...)
+		}
+		p.Label = string(append([]byte{}, p.Label...))
+		pl.Postings[i] = &p
+	}
+	return pl
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2016 DGraph Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * 		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package posting
+
+import (
+	"math"
+	"sync/atomic"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+
+	"github.com/dgraph-io/dgraph/types"
+)
+
+func TestPackedList(t *testing.T) {
+	pl := &types.PostingList{Checksum: []byte("checksum")}
+	for uid := uint64(1); uid <= 100; uid++ {
+		p := &types.Posting{Uid: uid * 3}
+		if uid%10 == 0 {
+			p.Label = "label"
+			p.Op = Add
+		}
+		pl.Postings = append(pl.Postings, p)
+	}
+	pl.Postings = append(pl.Postings, &types.Posting{
+		Uid:     math.MaxUint64,
+		Value:   []byte("value"),
+		ValType: types.Posting_STRING,
+		Commit:  1 << 40,
+	})
+
+	before := atomic.LoadInt64(&offHeapBytes)
+	pk := packPostingList(pl, 7)
+	require.True(t, atomic.LoadInt64(&offHeapBytes) > before)
+
+	require.Equal(t, len(pl.Postings), pk.length())
+	require.Equal(t, 0, pk.search(1))
+	require.Equal(t, 1, pk.search(4))
+	require.Equal(t, 1, pk.searchAfter(3))
+	require.Equal(t, 100, pk.search(301))
+	require.Equal(t, 101, pk.searchAfter(math.MaxUint64))
+	require.Equal(t, pl, pk.postingList())
+
+	var p types.Posting
+	pk.posting(9, &p)
+	require.Equal(t, *pl.Postings[9], p)
+
+	pk.free()
+	require.Equal(t, before, atomic.LoadInt64(&offHeapBytes))
+}
+
+func TestPackedListEmpty(t *testing.T) {
+	pk := packPostingList(new(types.PostingList), 0)
+	require.Equal(t, 0, pk.length())
+	require.Equal(t, 0, pk.search(10))
+	require.Empty(t, pk.postingList().Postings)
+	pk.free()
+}
@@ -67,19 +67,22 @@ func (db *DB) Close() {
 }
 
 // Get returns the data associated with the key from the database. Remember
-// to deallocate the returned Slice.
+// to deallocate the returned Slice. The Slice points directly to the value
+// read by RocksDB, so no further copies are made.
 func (db *DB) Get(opts *ReadOptions, key []byte) (*Slice, error) {
 	var (
-		cErr    *C.char
-		cValLen C.size_t
-		cKey    = byteToChar(key)
+		cErr *C.char
+		cKey = byteToChar(key)
 	)
-	cValue := C.rdb_get(db.c, opts.c, cKey, C.size_t(len(key)), &cValLen, &cErr)
+	cValue := C.rdb_get_value(db.c, opts.c, cKey, C.size_t(len(key)), &cErr)
 	if cErr != nil {
 		defer C.free(unsafe.Pointer(cErr))
 		return nil, errors.New(C.GoString(cErr))
 	}
-	return NewSlice(cValue, cValLen), nil
+	if cValue == nil {
+		return NewSlice(nil, 0), nil
+	}
+	return newValueSlice(cValue), nil
 }
 
 // GetBytes is like Get but returns a copy of the data.
@@ -157,5 +160,42 @@ func (db *DB) GetProperty(propName string) string {
 	return C.GoString(cValue)
 }
 
+// CompactRange runs a manual compaction on the Range of keys given. A nil
+// Start or Limit means the range is open on that side.
+func (db *DB) CompactRange(r Range) error {
+	var (
+		cErr   *C.char
+		cStart = byteToChar(r.Start)
+		cLimit = byteToChar(r.Limit)
+	)
+	C.rdb_compact_range(db.c, cStart, C.size_t(len(r.Start)), cLimit,
+		C.size_t(len(r.Limit)), &cErr)
+	if cErr != nil {
+		defer C.free(unsafe.Pointer(cErr))
+		return errors.New(C.GoString(cErr))
+	}
+	return nil
+}
+
+// ApproximateSize returns roughly the space used by the keys in the Range,
+// including the ones in the memtables.
+func (db *DB) ApproximateSize(r Range) uint64 {
+	cStart := byteToChar(r.Start)
+	cLimit := byteToChar(r.Limit)
+	return uint64(C.rdb_approximate_size(db.c, cStart, C.size_t(len(r.Start)), cLimit,
+		C.size_t(len(r.Limit))))
+}
+
+// Flush writes the memtables to table files, and waits until they are written.
+func (db *DB) Flush() error {
+	var cErr *C.char
+	C.rdb_flush(db.c, &cErr)
+	if cErr != nil {
+		defer C.free(unsafe.Pointer(cErr))
+		return errors.New(C.GoString(cErr))
+	}
+	return nil
+}
+
 // GetStats returns stats of our data store.
 func (db *DB) GetStats() string { return db.GetProperty("rocksdb.stats") }
@@ -0,0 +1,178 @@
+package rdb
+
+import (
+	"encoding/binary"
+	"fmt"
+	"io/ioutil"
+	"math/rand"
+	"os"
+	"testing"
+
+	"github.com/dgraph-io/dgraph/bench"
+	"github.com/dgraph-io/dgraph/x"
+)
+
+// These benchmarks call straight into rdbc, so they measure the C++ layer plus
+// a cgo call, without any of the store or posting logic on top.
+
+const benchAttr = "friend"
+
+// openBenchDB opens a database in a temporary directory, and loads the
+// adjacency lists of the synthetic graph into it, one value per entity. The
+// memtable is then flushed and compacted, so reads hit the table files.
+func openBenchDB(b *testing.B) (*DB, *bench.Graph, func()) {
+	dir, err := ioutil.TempDir("", "rdbbench_")
+	if err != nil {
+		b.Fatal(err)
+	}
+	opt := NewDefaultOptions()
+	opt.SetCreateIfMissing(true)
+	bopt := NewDefaultBlockBasedTableOptions()
+	bopt.SetFilterPolicy(NewBloomFilter(16))
+	opt.SetBlockBasedTableFactory(bopt)
+	db, err := OpenDb(opt, dir)
+	if err != nil {
+		b.Fatal(err)
+	}
+
+	g := bench.NewGraph(bench.DefaultConfig)
+	wopt := NewDefaultWriteOptions()
+	wb := NewWriteBatch()
+	for i, dst := range g.Adjacency(benchAttr) {
+		wb.Put(x.DataKey(benchAttr, uint64(i)+1), encodeUids(dst))
+		if wb.Count() >= 1000 {
+			if err := db.Write(wopt, wb); err != nil {
+				b.Fatal(err)
+			}
+			wb.Clear()
+		}
+	}
+	if err := db.Write(wopt, wb); err != nil {
+		b.Fatal(err)
+	}
+	wb.Destroy()
+	if err := db.CompactRange(Range{}); err != nil {
+		b.Fatal(err)
+	}
+	return db, g, func() {
+		db.Close()
+		os.RemoveAll(dir)
+	}
+}
+
+func encodeUids(uids []uint64) []byte {
+	buf := make([]byte, 8*len(uids))
+	for i, uid := range uids {
+		binary.LittleEndian.PutUint64(buf[8*i:], uid)
+	}
+	return buf
+}
+
+func BenchmarkGet(b *testing.B) {
+	db, g, cleanup := openBenchDB(b)
+	defer cleanup()
+	ropt := NewDefaultReadOptions()
+
+	for _, copyVal := range []bool{false, true} {
+		name := "slice"
+		if copyVal {
+			name = "bytes"
+		}
+		b.Run(name, func(b *testing.B) {
+			r := rand.New(rand.NewSource(1))
+			keys := make([][]byte, b.N)
+			for i := range keys {
+				keys[i] = x.DataKey(benchAttr, uint64(r.Intn(g.Nodes))+1)
+			}
+			rec := bench.NewRecorder("rdb/get/"+name, b.N)
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				rec.Start()
+				if copyVal {
+					if _, err := db.GetBytes(ropt, keys[i]); err != nil {
+						b.Fatal(err)
+					}
+				} else {
+					s, err := db.Get(ropt, keys[i])
+					if err != nil {
+						b.Fatal(err)
+					}
+					s.Free()
+				}
+				rec.Stop()
+			}
+			b.StopTimer()
+			rec.Report(b)
+		})
+	}
+}
+
+func BenchmarkIteratorScan(b *testing.B) {
+	db, g, cleanup := openBenchDB(b)
+	defer cleanup()
+
+	for _, n := range []int{10, 100, 1000} {
+		b.Run(fmt.Sprintf("keys=%d", n), func(b *testing.B) {
+			ropt := NewDefaultReadOptions()
+			ropt.SetFillCache(false)
+			it := db.NewIterator(ropt)
+			defer it.Close()
+
+			r := rand.New(rand.NewSource(1))
+			rec := bench.NewRecorder(fmt.Sprintf("rdb/scan/keys=%d", n), b.N)
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				rec.Start()
+				it.Seek(x.DataKey(benchAttr, uint64(r.Intn(g.Nodes))+1))
+				for j := 0; j < n && it.Valid(); j++ {
+					it.Key().Free()
+					it.Value().Free()
+					it.Next()
+				}
+				rec.Stop()
+			}
+			b.StopTimer()
+			rec.Report(b)
+		})
+	}
+}
+
+func BenchmarkWriteBatch(b *testing.B) {
+	adj := bench.NewGraph(bench.DefaultConfig).Adjacency(benchAttr)
+	for _, n := range []int{1, 100, 1000} {
+		b.Run(fmt.Sprintf("batch=%d", n), func(b *testing.B) {
+			dir, err := ioutil.TempDir("", "rdbbench_")
+			if err != nil {
+				b.Fatal(err)
+			}
+			defer os.RemoveAll(dir)
+			opt := NewDefaultOptions()
+			opt.SetCreateIfMissing(true)
+			db, err := OpenDb(opt, dir)
+			if err != nil {
+				b.Fatal(err)
+			}
+			defer db.Close()
+
+			wopt := NewDefaultWriteOptions()
+			wb := NewWriteBatch()
+			defer wb.Destroy()
+			rec := bench.NewRecorder(fmt.Sprintf("rdb/write/batch=%d", n), b.N)
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				for j := 0; j < n; j++ {
+					uid := (i*n + j) % len(adj)
+					wb.Put(x.DataKey(benchAttr, uint64(uid)+1), encodeUids(adj[uid]))
+				}
+				rec.Start()
+				if err := db.Write(wopt, wb); err != nil {
+					b.Fatal(err)
+				}
+				rec.Stop()
+				wb.Clear()
+			}
+			b.StopTimer()
+			rec.Report(b)
+		})
+	}
+}
@@ -54,7 +54,7 @@ func (iter *Iterator) Key() *Slice {
 	if cKey == nil {
 		return nil
 	}
-	return &Slice{cKey, cLen, true}
+	return &Slice{data: cKey, size: cLen, freed: true}
 }
 
 // Value returns the value in the database the iterator currently holds.
@@ -64,7 +64,7 @@ func (iter *Iterator) Value() *Slice {
 	if cVal == nil {
 		return nil
 	}
-	return &Slice{cVal, cLen, true}
+	return &Slice{data: cVal, size: cLen, freed: true}
 }
 
 // Next moves the iterator to the next sequential key in the database.
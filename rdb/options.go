@@ -33,3 +33,55 @@ func (opts *Options) SetBlockBasedTableFactory(value *BlockBasedTableOptions) {
 	opts.bbto = value
 	C.rdb_options_set_block_based_table_factory(opts.c, value.c)
 }
+
+// PrepareForBulkLoad tunes the database for loading a lot of data at once. It
+// turns off auto compactions and write stalls, so everything is left in level 0
+// until the application issues a manual compaction via DB.CompactRange.
+func (opts *Options) PrepareForBulkLoad() {
+	C.rdb_options_prepare_for_bulk_load(opts.c)
+}
+
+// SetDisableAutoCompactions disables automatic compactions. Manual compactions
+// can still be issued via DB.CompactRange.
+// Default: false
+func (opts *Options) SetDisableAutoCompactions(value bool) {
+	C.rdb_options_set_disable_auto_compactions(opts.c, boolToChar(value))
+}
+
+// SetWriteBufferSize sets the amount of data to build up in memory (backed by
+// an unsorted log on disk) before converting to a sorted on-disk file.
+// Default: 64MB
+func (opts *Options) SetWriteBufferSize(value int) {
+	C.rdb_options_set_write_buffer_size(opts.c, C.size_t(value))
+}
+
+// SetMaxWriteBufferNumber sets the maximum number of write buffers that are
+// built up in memory. Once one is full, writes continue into another while it
+// is flushed to storage.
+// Default: 2
+func (opts *Options) SetMaxWriteBufferNumber(value int) {
+	C.rdb_options_set_max_write_buffer_number(opts.c, C.int(value))
+}
+
+// SetMemtableVectorRep uses a vector backed memtable. Inserts are cheap, as the
+// vector is only sorted when the memtable is flushed or read. This suits
+// write-only loads, but reads from the memtable have to sort a copy of it.
+// Default: skip list
+func (opts *Options) SetMemtableVectorRep() {
+	C.rdb_options_set_memtable_vector_rep(opts.c)
+}
+
+// SetAllowMmapReads allows the OS to mmap the table files for reading. Reads
+// are then served from the page cache, without a pread call per block.
+// Default: false
+func (opts *Options) SetAllowMmapReads(value bool) {
+	C.rdb_options_set_allow_mmap_reads(opts.c, boolToChar(value))
+}
+
+// SetMaxOpenFiles sets the number of open files that can be used by the DB.
+// A value of -1 keeps all files open, so the index and filter blocks of every
+// table are loaded once and stay in memory.
+// Default: 5000
+func (opts *Options) SetMaxOpenFiles(value int) {
+	C.rdb_options_set_max_open_files(opts.c, C.int(value))
+}
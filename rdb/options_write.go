@@ -29,6 +29,14 @@ func (opts *WriteOptions) SetSync(value bool) {
 	C.rdb_writeoptions_set_sync(opts.c, boolToChar(value))
 }
 
+// DisableWAL sets whether the write should skip the write-ahead log. Writes
+// which aren't yet flushed to storage are lost if the process crashes, so only
+// use this for data which can be rebuilt.
+// Default: false
+func (opts *WriteOptions) DisableWAL(value bool) {
+	C.rdb_writeoptions_disable_WAL(opts.c, boolToChar(value))
+}
+
 // Destroy deallocates the WriteOptions object.
 func (opts *WriteOptions) Destroy() {
 	C.rdb_writeoptions_destroy(opts.c)
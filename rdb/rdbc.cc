@@ -10,6 +10,7 @@
 #include "rocksdb/db.h"
 #include "rocksdb/filter_policy.h"
 #include "rocksdb/iterator.h"
+#include "rocksdb/memtablerep.h"
 #include "rocksdb/options.h"
 #include "rocksdb/snapshot.h"
 #include "rocksdb/status.h"
@@ -35,6 +36,8 @@ using rocksdb::NewLRUCache;
 using rocksdb::BlockBasedTableOptions;
 using rocksdb::Snapshot;
 using rocksdb::Checkpoint;
+using rocksdb::CompactRangeOptions;
+using rocksdb::FlushOptions;
 
 struct rdb_t { DB* rep; };
 struct rdb_options_t { Options rep; };
@@ -49,6 +52,7 @@ struct rdb_cache_t { std::shared_ptr<Cache> rep; };
 struct rdb_block_based_table_options_t { BlockBasedTableOptions rep; };
 struct rdb_snapshot_t { const Snapshot* rep; };
 struct rdb_checkpoint_t { Checkpoint* rep; };
+struct rdb_value_t { std::string rep; };
 
 bool SaveError(char** errptr, const Status& s) {
   assert(errptr != nullptr);
@@ -125,6 +129,34 @@ char* rdb_get(
   return result;
 }
 
+// rdb_get_value is like rdb_get, but hands out the string RocksDB copied the
+// value into, instead of making another copy of it.
+rdb_value_t* rdb_get_value(
+    rdb_t* db,
+    const rdb_readoptions_t* options,
+    const char* key, size_t keylen,
+    char** errptr) {
+  rdb_value_t* result = new rdb_value_t;
+  Status s = db->rep->Get(options->rep, Slice(key, keylen), &result->rep);
+  if (!s.ok()) {
+    delete result;
+    if (!s.IsNotFound()) {
+      SaveError(errptr, s);
+    }
+    return nullptr;
+  }
+  return result;
+}
+
+const char* rdb_value_data(const rdb_value_t* value, size_t* vallen) {
+  *vallen = value->rep.size();
+  return value->rep.data();
+}
+
+void rdb_value_destroy(rdb_value_t* value) {
+  delete value;
+}
+
 void rdb_put(
     rdb_t* db,
     const rdb_writeoptions_t* options,
@@ -155,6 +187,35 @@ char* rdb_property_value(
   }
 }
 
+void rdb_compact_range(
+    rdb_t* db,
+    const char* start_key, size_t start_key_len,
+    const char* limit_key, size_t limit_key_len,
+    char** errptr) {
+  Slice a, b;
+  SaveError(errptr, db->rep->CompactRange(
+      CompactRangeOptions(),
+      // Pass nullptr Slice if corresponding "const char*" is nullptr
+      (start_key ? (a = Slice(start_key, start_key_len), &a) : nullptr),
+      (limit_key ? (b = Slice(limit_key, limit_key_len), &b) : nullptr)));
+}
+
+uint64_t rdb_approximate_size(
+    rdb_t* db,
+    const char* start_key, size_t start_key_len,
+    const char* limit_key, size_t limit_key_len) {
+  rocksdb::Range r(Slice(start_key, start_key_len), Slice(limit_key, limit_key_len));
+  uint64_t size = 0;
+  db->rep->GetApproximateSizes(&r, 1, &size, true);
+  return size;
+}
+
+void rdb_flush(
+    rdb_t* db,
+    char** errptr) {
+  SaveError(errptr, db->rep->Flush(FlushOptions()));
+}
+
 //////////////////////////// rdb_writebatch_t
 rdb_writebatch_t* rdb_writebatch_create() {
   return new rdb_writebatch_t;
@@ -219,6 +280,39 @@ void rdb_options_set_block_based_table_factory(
   }
 }
 
+void rdb_options_prepare_for_bulk_load(rdb_options_t* opt) {
+  opt->rep.PrepareForBulkLoad();
+}
+
+void rdb_options_set_disable_auto_compactions(
+    rdb_options_t* opt, unsigned char v) {
+  opt->rep.disable_auto_compactions = v;
+}
+
+void rdb_options_set_write_buffer_size(
+    rdb_options_t* opt, size_t s) {
+  opt->rep.write_buffer_size = s;
+}
+
+void rdb_options_set_max_write_buffer_number(
+    rdb_options_t* opt, int n) {
+  opt->rep.max_write_buffer_number = n;
+}
+
+void rdb_options_set_memtable_vector_rep(rdb_options_t* opt) {
+  opt->rep.memtable_factory.reset(new rocksdb::VectorRepFactory);
+}
+
+void rdb_options_set_allow_mmap_reads(
+    rdb_options_t* opt, unsigned char v) {
+  opt->rep.allow_mmap_reads = v;
+}
+
+void rdb_options_set_max_open_files(
+    rdb_options_t* opt, int n) {
+  opt->rep.max_open_files = n;
+}
+
 //////////////////////////// rdb_readoptions_t
 rdb_readoptions_t* rdb_readoptions_create() {
   return new rdb_readoptions_t;
@@ -253,6 +347,11 @@ void rdb_writeoptions_set_sync(
   opt->rep.sync = v;
 }
 
+void rdb_writeoptions_disable_WAL(
+    rdb_writeoptions_t* opt, unsigned char v) {
+  opt->rep.disableWAL = v;
+}
+
 //////////////////////////// rdb_iterator_t
 rdb_iterator_t* rdb_create_iterator(
     rdb_t* db,
@@ -19,6 +19,7 @@ typedef struct rdb_cache_t rdb_cache_t;
 typedef struct rdb_block_based_table_options_t rdb_block_based_table_options_t;
 typedef struct rdb_snapshot_t rdb_snapshot_t;
 typedef struct rdb_checkpoint_t rdb_checkpoint_t;
+typedef struct rdb_value_t rdb_value_t;
 
 //////////////////////////// rdb_t
 rdb_t* rdb_open(
@@ -37,6 +38,13 @@ char* rdb_get(
     const char* key, size_t keylen,
     size_t* vallen,
     char** errptr);
+rdb_value_t* rdb_get_value(
+    rdb_t* db,
+    const rdb_readoptions_t* options,
+    const char* key, size_t keylen,
+    char** errptr);
+const char* rdb_value_data(const rdb_value_t* value, size_t* vallen);
+void rdb_value_destroy(rdb_value_t* value);
 void rdb_put(
     rdb_t* db,
     const rdb_writeoptions_t* options,
@@ -51,6 +59,18 @@ void rdb_delete(
 char* rdb_property_value(
     rdb_t* db,
     const char* propname);
+void rdb_compact_range(
+    rdb_t* db,
+    const char* start_key, size_t start_key_len,
+    const char* limit_key, size_t limit_key_len,
+    char** errptr);
+uint64_t rdb_approximate_size(
+    rdb_t* db,
+    const char* start_key, size_t start_key_len,
+    const char* limit_key, size_t limit_key_len);
+void rdb_flush(
+    rdb_t* db,
+    char** errptr);
 
 //////////////////////////// rdb_writebatch_t
 rdb_writebatch_t* rdb_writebatch_create();
@@ -78,6 +98,18 @@ void rdb_options_set_create_if_missing(
 void rdb_options_set_block_based_table_factory(
     rdb_options_t *opt,
     rdb_block_based_table_options_t* table_options);
+void rdb_options_prepare_for_bulk_load(rdb_options_t* opt);
+void rdb_options_set_disable_auto_compactions(
+    rdb_options_t* opt, unsigned char v);
+void rdb_options_set_write_buffer_size(
+    rdb_options_t* opt, size_t s);
+void rdb_options_set_max_write_buffer_number(
+    rdb_options_t* opt, int n);
+void rdb_options_set_memtable_vector_rep(rdb_options_t* opt);
+void rdb_options_set_allow_mmap_reads(
+    rdb_options_t* opt, unsigned char v);
+void rdb_options_set_max_open_files(
+    rdb_options_t* opt, int n);
 
 //////////////////////////// rdb_readoptions_t
 rdb_readoptions_t* rdb_readoptions_create();
@@ -93,6 +125,8 @@ rdb_writeoptions_t* rdb_writeoptions_create();
 void rdb_writeoptions_destroy(rdb_writeoptions_t* opt);
 void rdb_writeoptions_set_sync(
     rdb_writeoptions_t* opt, unsigned char v);
+void rdb_writeoptions_disable_WAL(
+    rdb_writeoptions_t* opt, unsigned char v);
 
 //////////////////////////// rdb_iterator_t
 rdb_iterator_t* rdb_create_iterator(
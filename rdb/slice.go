@@ -11,11 +11,19 @@ type Slice struct {
 	data  *C.char
 	size  C.size_t
 	freed bool
+	value *C.rdb_value_t // If set, owns data.
 }
 
 // NewSlice returns a slice with the given data.
 func NewSlice(data *C.char, size C.size_t) *Slice {
-	return &Slice{data, size, false}
+	return &Slice{data: data, size: size}
+}
+
+// newValueSlice returns a slice pointing to the data held by value.
+func newValueSlice(value *C.rdb_value_t) *Slice {
+	s := &Slice{value: value}
+	s.data = C.rdb_value_data(value, &s.size)
+	return s
 }
 
 // Data returns the data of the slice.
@@ -30,8 +38,13 @@ func (s *Slice) Size() int {
 
 // Free frees the slice data.
 func (s *Slice) Free() {
-	if !s.freed {
+	if s.freed {
+		return
+	}
+	if s.value != nil {
+		C.rdb_value_destroy(s.value)
+	} else {
 		C.free(unsafe.Pointer(s.data))
-		s.freed = true
 	}
+	s.freed = true
 }
@@ -25,6 +25,9 @@ import (
 
 var log = x.Log("store")
 
+// bulkWriteBufferSize is the size of each memtable used by NewBulkStore.
+const bulkWriteBufferSize = 256 << 20
+
 // Store contains some handles to RocksDB.
 type Store struct {
 	db       *rdb.DB
@@ -32,6 +35,8 @@ type Store struct {
 	blockopt *rdb.BlockBasedTableOptions
 	ropt     *rdb.ReadOptions
 	wopt     *rdb.WriteOptions
+	noWAL    bool // Writes skip the RocksDB WAL.
+	readOnly bool
 }
 
 func (s *Store) setOpts() {
@@ -78,6 +83,48 @@ func NewReadOnlyStore(filepath string) (*Store, error) {
 	s.setOpts()
 	var err error
 	s.db, err = rdb.OpenDbForReadOnly(s.opt, filepath, false)
+	s.readOnly = true
+	return s, x.Wrap(err)
+}
+
+// NewMmapReadOnlyStore constructs a readonly Store object at filepath, tuned
+// for serving point lookups from a store which fits in memory. Table files are
+// mmapped, so reads don't need a pread call per block, and all of them are kept
+// open, so their index and filter blocks stay loaded. Tables are compressed, so
+// the decompressed data blocks are kept in an LRU block cache of cacheSize
+// bytes, instead of decompressing them again on every read.
+func NewMmapReadOnlyStore(filepath string, cacheSize int) (*Store, error) {
+	s := &Store{}
+	s.setOpts()
+	s.opt.SetAllowMmapReads(true)
+	s.opt.SetMaxOpenFiles(-1)
+	s.blockopt.SetBlockCache(rdb.NewLRUCache(cacheSize))
+	s.opt.SetBlockBasedTableFactory(s.blockopt)
+	var err error
+	s.db, err = rdb.OpenDbForReadOnly(s.opt, filepath, false)
+	s.readOnly = true
+	return s, x.Wrap(err)
+}
+
+// NewBulkStore constructs a Store at filepath, tuned for an initial import. Auto
+// compactions are off, write buffers are large, and writes skip the RocksDB
+// WAL, so data which isn't yet flushed is lost on a crash. It can only be
+// rebuilt from the RAFT log, so callers must Flush before truncating it; see
+// SkipsWAL. Call CompactAll once the import is done, and reopen with
+// NewSyncStore to serve.
+func NewBulkStore(filepath string, vectorMemtable bool) (*Store, error) {
+	s := &Store{}
+	s.setOpts()
+	s.opt.PrepareForBulkLoad()
+	s.opt.SetWriteBufferSize(bulkWriteBufferSize)
+	s.opt.SetMaxWriteBufferNumber(6)
+	if vectorMemtable {
+		s.opt.SetMemtableVectorRep()
+	}
+	s.wopt.DisableWAL(true)
+	s.noWAL = true
+	var err error
+	s.db, err = rdb.OpenDb(s.opt, filepath)
 	return s, x.Wrap(err)
 }
 
@@ -129,6 +176,26 @@ func (s *Store) WriteBatch(wb *rdb.WriteBatch) error {
 	return x.Wrap(s.db.Write(s.wopt, wb))
 }
 
+// ApproximateSize returns roughly the space used by the keys in [start, limit).
+func (s *Store) ApproximateSize(start, limit []byte) uint64 {
+	return s.db.ApproximateSize(rdb.Range{Start: start, Limit: limit})
+}
+
+// ReadOnly returns whether the store was opened read-only, in which case all
+// writes fail.
+func (s *Store) ReadOnly() bool { return s.readOnly }
+
+// SkipsWAL returns whether writes skip the RocksDB WAL, in which case they only
+// survive a crash once flushed.
+func (s *Store) SkipsWAL() bool { return s.noWAL }
+
+// Flush writes the memtables to table files, so that all the writes so far
+// survive a crash.
+func (s *Store) Flush() error { return x.Wrap(s.db.Flush()) }
+
+// CompactAll flushes the memtables, and compacts all the keys in the store.
+func (s *Store) CompactAll() error { return x.Wrap(s.db.CompactRange(rdb.Range{})) }
+
 // NewCheckpoint creates new checkpoint from current store.
 func (s *Store) NewCheckpoint() (*rdb.Checkpoint, error) { return s.db.NewCheckpoint() }
 
@@ -121,6 +121,74 @@ func TestCheckpoint(t *testing.T) {
 	require.EqualValues(t, val.Data(), "neo")
 }
 
+func TestMmapReadOnlyStore(t *testing.T) {
+	path, err := ioutil.TempDir("", "storetest_")
+	require.NoError(t, err)
+	defer os.RemoveAll(path)
+
+	s, err := NewStore(path)
+	require.NoError(t, err)
+	for i := 0; i < 1000; i++ {
+		k := []byte(fmt.Sprintf("key_%04d", i))
+		require.NoError(t, s.SetOne(k, []byte(fmt.Sprintf("val_%d", i))))
+	}
+	require.NoError(t, s.CompactAll())
+	s.Close()
+
+	s, err = NewMmapReadOnlyStore(path, 8<<20)
+	require.NoError(t, err)
+	defer s.Close()
+
+	val, err := s.Get([]byte("key_0042"))
+	require.NoError(t, err)
+	require.EqualValues(t, "val_42", val.Data())
+	val.Free()
+
+	val, err = s.Get([]byte("missing"))
+	require.NoError(t, err)
+	require.Equal(t, 0, val.Size())
+	val.Free()
+
+	require.True(t, s.ReadOnly())
+	require.Error(t, s.SetOne([]byte("key_0042"), []byte("new")))
+}
+
+func TestBulkStore(t *testing.T) {
+	for _, vector := range []bool{false, true} {
+		path, err := ioutil.TempDir("", "storetest_")
+		require.NoError(t, err)
+		defer os.RemoveAll(path)
+
+		s, err := NewBulkStore(path, vector)
+		require.NoError(t, err)
+		for i := 0; i < 1000; i++ {
+			k := []byte(fmt.Sprintf("key_%04d", i))
+			require.NoError(t, s.SetOne(k, []byte(fmt.Sprintf("val_%d", i))))
+		}
+		val, err := s.Get([]byte("key_0010"))
+		require.NoError(t, err)
+		require.EqualValues(t, "val_10", val.Data())
+
+		// The writes skipped the WAL, so they're only in the memtable until flushed.
+		require.True(t, s.SkipsWAL())
+		require.Equal(t, "1000", s.db.GetProperty("rocksdb.num-entries-active-mem-table"))
+		require.NoError(t, s.Flush())
+		require.Equal(t, "0", s.db.GetProperty("rocksdb.num-entries-active-mem-table"))
+		require.Equal(t, "1", s.db.GetProperty("rocksdb.num-files-at-level0"))
+
+		require.NoError(t, s.CompactAll())
+		s.Close()
+
+		// Reopen with the serving profile.
+		s, err = NewSyncStore(path)
+		require.NoError(t, err)
+		val, err = s.Get([]byte("key_0999"))
+		require.NoError(t, err)
+		require.EqualValues(t, "val_999", val.Data())
+		s.Close()
+	}
+}
+
 func benchmarkGet(valSize int, b *testing.B) {
 	path, err := ioutil.TempDir("", "storetest_")
 	if err != nil {
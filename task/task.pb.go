@@ -25,6 +25,8 @@
 		KV
 		KC
 		GroupKeys
+		BatchQuery
+		BatchResult
 */
 package task
 
@@ -320,6 +322,41 @@ func (m *GroupKeys) GetKeys() []*KC {
 	return nil
 }
 
+// BatchQuery packs together the queries for a group, so they can be served
+// with a single round trip.
+type BatchQuery struct {
+	Queries []*Query `protobuf:"bytes,1,rep,name=queries" json:"queries,omitempty"`
+}
+
+func (m *BatchQuery) Reset()                    { *m = BatchQuery{} }
+func (m *BatchQuery) String() string            { return proto.CompactTextString(m) }
+func (*BatchQuery) ProtoMessage()               {}
+func (*BatchQuery) Descriptor() ([]byte, []int) { return fileDescriptorTask, []int{16} }
+
+func (m *BatchQuery) GetQueries() []*Query {
+	if m != nil {
+		return m.Queries
+	}
+	return nil
+}
+
+type BatchResult struct {
+	Results []*Result `protobuf:"bytes,1,rep,name=results" json:"results,omitempty"`
+	Errors  []string  `protobuf:"bytes,2,rep,name=errors" json:"errors,omitempty"`
+}
+
+func (m *BatchResult) Reset()                    { *m = BatchResult{} }
+func (m *BatchResult) String() string            { return proto.CompactTextString(m) }
+func (*BatchResult) ProtoMessage()               {}
+func (*BatchResult) Descriptor() ([]byte, []int) { return fileDescriptorTask, []int{17} }
+
+func (m *BatchResult) GetResults() []*Result {
+	if m != nil {
+		return m.Results
+	}
+	return nil
+}
+
 func init() {
 	proto.RegisterType((*List)(nil), "task.List")
 	proto.RegisterType((*Value)(nil), "task.Value")
@@ -337,6 +374,8 @@ func init() {
 	proto.RegisterType((*KV)(nil), "task.KV")
 	proto.RegisterType((*KC)(nil), "task.KC")
 	proto.RegisterType((*GroupKeys)(nil), "task.GroupKeys")
+	proto.RegisterType((*BatchQuery)(nil), "task.BatchQuery")
+	proto.RegisterType((*BatchResult)(nil), "task.BatchResult")
 	proto.RegisterEnum("task.DirectedEdge_Op", DirectedEdge_Op_name, DirectedEdge_Op_value)
 }
 func (m *List) Marshal() (data []byte, err error) {
@@ -1057,6 +1096,81 @@ func (m *GroupKeys) MarshalTo(data []byte) (int, error) {
 	return i, nil
 }
 
+func (m *BatchQuery) Marshal() (data []byte, err error) {
+	size := m.Size()
+	data = make([]byte, size)
+	n, err := m.MarshalTo(data)
+	if err != nil {
+		return nil, err
+	}
+	return data[:n], nil
+}
+
+func (m *BatchQuery) MarshalTo(data []byte) (int, error) {
+	var i int
+	_ = i
+	var l int
+	_ = l
+	if len(m.Queries) > 0 {
+		for _, msg := range m.Queries {
+			data[i] = 0xa
+			i++
+			i = encodeVarintTask(data, i, uint64(msg.Size()))
+			n, err := msg.MarshalTo(data[i:])
+			if err != nil {
+				return 0, err
+			}
+			i += n
+		}
+	}
+	return i, nil
+}
+
+func (m *BatchResult) Marshal() (data []byte, err error) {
+	size := m.Size()
+	data = make([]byte, size)
+	n, err := m.MarshalTo(data)
+	if err != nil {
+		return nil, err
+	}
+	return data[:n], nil
+}
+
+func (m *BatchResult) MarshalTo(data []byte) (int, error) {
+	var i int
+	_ = i
+	var l int
+	_ = l
+	if len(m.Results) > 0 {
+		for _, msg := range m.Results {
+			data[i] = 0xa
+			i++
+			i = encodeVarintTask(data, i, uint64(msg.Size()))
+			n, err := msg.MarshalTo(data[i:])
+			if err != nil {
+				return 0, err
+			}
+			i += n
+		}
+	}
+	if len(m.Errors) > 0 {
+		for _, s := range m.Errors {
+			data[i] = 0x12
+			i++
+			l = len(s)
+			for l >= 1<<7 {
+				data[i] = uint8(uint64(l)&0x7f | 0x80)
+				l >>= 7
+				i++
+			}
+			data[i] = uint8(l)
+			i++
+			i += copy(data[i:], s)
+		}
+	}
+	return i, nil
+}
+
 func encodeFixed64Task(data []byte, offset int, v uint64) int {
 	data[offset] = uint8(v)
 	data[offset+1] = uint8(v >> 8)
@@ -1388,6 +1502,36 @@ func (m *GroupKeys) Size() (n int) {
 	return n
 }
 
+func (m *BatchQuery) Size() (n int) {
+	var l int
+	_ = l
+	if len(m.Queries) > 0 {
+		for _, e := range m.Queries {
+			l = e.Size()
+			n += 1 + l + sovTask(uint64(l))
+		}
+	}
+	return n
+}
+
+func (m *BatchResult) Size() (n int) {
+	var l int
+	_ = l
+	if len(m.Results) > 0 {
+		for _, e := range m.Results {
+			l = e.Size()
+			n += 1 + l + sovTask(uint64(l))
+		}
+	}
+	if len(m.Errors) > 0 {
+		for _, s := range m.Errors {
+			l = len(s)
+			n += 1 + l + sovTask(uint64(l))
+		}
+	}
+	return n
+}
+
 func sovTask(x uint64) (n int) {
 	for {
 		n++
@@ -3507,6 +3651,197 @@ func (m *GroupKeys) Unmarshal(data []byte) error {
 	}
 	return nil
 }
+func (m *BatchQuery) Unmarshal(data []byte) error {
+	l := len(data)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowTask
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := data[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: BatchQuery: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: BatchQuery: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Queries", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowTask
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := data[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthTask
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Queries = append(m.Queries, &Query{})
+			if err := m.Queries[len(m.Queries)-1].Unmarshal(data[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipTask(data[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthTask
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *BatchResult) Unmarshal(data []byte) error {
+	l := len(data)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowTask
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := data[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: BatchResult: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: BatchResult: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Results", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowTask
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := data[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthTask
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Results = append(m.Results, &Result{})
+			if err := m.Results[len(m.Results)-1].Unmarshal(data[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Errors", wireType)
+			}
+			var stringLen uint64
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowTask
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := data[iNdEx]
+				iNdEx++
+				stringLen |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			intStringLen := int(stringLen)
+			if intStringLen < 0 {
+				return ErrInvalidLengthTask
+			}
+			postIndex := iNdEx + intStringLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Errors = append(m.Errors, string(data[iNdEx:postIndex]))
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipTask(data[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthTask
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
 func skipTask(data []byte) (n int, err error) {
 	l := len(data)
 	iNdEx := 0
@@ -3615,58 +3950,61 @@ var (
 func init() { proto.RegisterFile("task.proto", fileDescriptorTask) }
 
 var fileDescriptorTask = []byte{
-	// 844 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x09, 0x6e, 0x88, 0x02, 0xff, 0x94, 0x55, 0xdb, 0x6e, 0x23, 0x45,
-	0x10, 0xdd, 0xb9, 0x78, 0x2e, 0x65, 0x3b, 0x58, 0x2d, 0x58, 0xcc, 0x02, 0x0b, 0x1a, 0x84, 0x64,
-	0x90, 0x88, 0x90, 0x41, 0xe2, 0x79, 0xb1, 0xc3, 0x6a, 0x95, 0x0d, 0xbb, 0xf4, 0x26, 0x79, 0x1d,
-	0x4d, 0x3c, 0xed, 0x64, 0x14, 0x8f, 0x67, 0x34, 0xd3, 0x13, 0xc5, 0xe2, 0x03, 0xf8, 0x04, 0x78,
-	0x41, 0xe2, 0x73, 0x10, 0x4f, 0xfc, 0x01, 0x08, 0x7e, 0x84, 0xea, 0xea, 0x1e, 0x5f, 0x12, 0x2b,
-	0x12, 0x0f, 0x56, 0xea, 0x54, 0xd7, 0x54, 0x57, 0x9d, 0x3a, 0x5d, 0x01, 0x90, 0x49, 0x7d, 0x7d,
-	0x58, 0x56, 0x85, 0x2c, 0x98, 0xab, 0xec, 0xe8, 0x09, 0xb8, 0x2f, 0xb3, 0x5a, 0x32, 0x06, 0x6e,
-	0x93, 0xa5, 0xf5, 0xd0, 0xfa, 0xd8, 0x19, 0x79, 0x9c, 0xec, 0xe8, 0x6b, 0xe8, 0x9c, 0x27, 0x8b,
-	0x46, 0xb0, 0x01, 0x38, 0x37, 0xc9, 0x02, 0xcf, 0xac, 0x51, 0x8f, 0x2b, 0x93, 0xbd, 0x07, 0x01,
-	0xfe, 0x89, 0xe5, 0xaa, 0x14, 0x43, 0x1b, 0xdd, 0x1d, 0xee, 0x23, 0x3e, 0x45, 0x18, 0xfd, 0x61,
-	0x41, 0xe7, 0x87, 0x46, 0x54, 0x2b, 0x95, 0x33, 0x91, 0xb2, 0xa2, 0xef, 0x42, 0x4e, 0x36, 0x7b,
-	0x1b, 0x3a, 0xb3, 0xa2, 0x59, 0x4a, 0xf3, 0x95, 0x06, 0xec, 0x31, 0x78, 0xc5, 0x7c, 0x5e, 0x0b,
-	0x39, 0x74, 0xc8, 0x6d, 0x10, 0x7b, 0x1f, 0xc2, 0x64, 0x2e, 0x45, 0x15, 0x63, 0x3d, 0x43, 0x17,
-	0x8f, 0x3c, 0x1e, 0x90, 0xe3, 0x2c, 0x4b, 0x55, 0x0d, 0x69, 0x11, 0xeb, 0x6c, 0x1d, 0x3c, 0x0b,
-	0xb8, 0x9f, 0x16, 0x13, 0xca, 0xd7, 0x76, 0xe3, 0x6d, 0xba, 0x51, 0xe1, 0x75, 0x35, 0x8b, 0xe7,
-	0xcd, 0x72, 0x36, 0xf4, 0xd1, 0x1f, 0x72, 0x1f, 0xf1, 0x77, 0x08, 0xd9, 0x10, 0xfc, 0x4a, 0xdc,
-	0x88, 0xaa, 0x16, 0xc3, 0x40, 0x27, 0x32, 0x30, 0xfa, 0xd9, 0x02, 0x8f, 0x8b, 0xba, 0x59, 0x48,
-	0xf6, 0x19, 0x00, 0xe6, 0x89, 0xf3, 0x44, 0x56, 0xd9, 0x2d, 0xf1, 0xd4, 0x1d, 0xc3, 0x21, 0x11,
-	0xaa, 0x18, 0xe4, 0x21, 0x9e, 0x9e, 0xd0, 0x21, 0xfb, 0x04, 0xbc, 0x1b, 0x45, 0x5c, 0x8d, 0x5d,
-	0xaa, 0xb0, 0xae, 0x0e, 0x23, 0x32, 0xb9, 0x39, 0x52, 0x3d, 0x53, 0xed, 0x35, 0xf6, 0xec, 0x8c,
-	0xfa, 0xdc, 0x20, 0xf6, 0x29, 0x1c, 0x64, 0x4b, 0xa9, 0x6e, 0x9f, 0xc9, 0x38, 0x15, 0xb5, 0xa4,
-	0xc6, 0x03, 0xde, 0x5f, 0x7b, 0xa7, 0xe8, 0x8c, 0x7e, 0xb2, 0xc0, 0x7d, 0x53, 0x54, 0x72, 0x2f,
-	0xcb, 0xbb, 0xb5, 0xda, 0x0f, 0xd5, 0xba, 0x1e, 0x88, 0xb3, 0x7f, 0x20, 0xee, 0xce, 0x40, 0xf0,
-	0x32, 0x2c, 0x69, 0x66, 0xf8, 0x26, 0x3b, 0xfa, 0x06, 0x40, 0x15, 0xf2, 0xbf, 0x69, 0x8a, 0x9e,
-	0x81, 0xf3, 0x7d, 0x93, 0xab, 0x0a, 0x2e, 0xab, 0xa2, 0x29, 0xa9, 0x83, 0x3e, 0xd7, 0xa0, 0xd5,
-	0x9c, 0x92, 0x89, 0xa3, 0x35, 0xd7, 0x0e, 0x55, 0xd1, 0xe5, 0x1a, 0x89, 0x3e, 0x87, 0x2e, 0x47,
-	0x41, 0x4c, 0x0a, 0xe4, 0xe6, 0x56, 0xb2, 0x03, 0xb0, 0x51, 0x28, 0x16, 0x09, 0x05, 0xad, 0x4d,
-	0x6a, 0x7b, 0x3b, 0xb5, 0x62, 0x2c, 0x4d, 0x2b, 0xea, 0x58, 0x31, 0x86, 0x76, 0xf4, 0xab, 0x05,
-	0x70, 0x22, 0xf2, 0x0b, 0x64, 0xf8, 0x2a, 0x2b, 0xef, 0x25, 0x42, 0xf1, 0xd0, 0xb7, 0x31, 0x7a,
-	0x75, 0x2e, 0x9f, 0xf0, 0x8b, 0x74, 0x5f, 0x36, 0x45, 0xdf, 0x42, 0x24, 0xa9, 0xa8, 0xcc, 0xec,
-	0x0c, 0x62, 0xef, 0x82, 0x9f, 0xe4, 0x38, 0xd4, 0x24, 0x35, 0x0c, 0x7a, 0x49, 0x3e, 0x45, 0xc4,
-	0x3e, 0x82, 0xee, 0x22, 0xa9, 0x65, 0xdc, 0x94, 0x69, 0x22, 0x05, 0xea, 0xd6, 0xc2, 0x16, 0x41,
-	0xb9, 0xce, 0xc8, 0x13, 0xfd, 0x66, 0xc1, 0x60, 0x53, 0x9f, 0x76, 0xb2, 0xcf, 0xc1, 0xcf, 0xb5,
-	0xcf, 0x10, 0x3d, 0xd0, 0x44, 0x6f, 0x02, 0x79, 0x1b, 0x70, 0xf7, 0x06, 0xfb, 0xee, 0x0d, 0xec,
-	0x09, 0x04, 0x95, 0x48, 0xb3, 0x0a, 0x05, 0x46, 0xbd, 0x04, 0x7c, 0x8d, 0x51, 0xd0, 0xfd, 0xd6,
-	0x8e, 0xa9, 0x59, 0x97, 0x9a, 0xed, 0xb5, 0xce, 0x67, 0x8a, 0xc2, 0xbf, 0x2c, 0xe8, 0x4d, 0x09,
-	0x8a, 0xf4, 0x28, 0xbd, 0x14, 0x8a, 0x05, 0xb1, 0x94, 0x99, 0x5c, 0x19, 0x22, 0x0d, 0x5a, 0x2b,
-	0xd6, 0xde, 0xdd, 0x0b, 0xf4, 0x2e, 0xe8, 0xea, 0x1e, 0xd7, 0x80, 0x7d, 0x08, 0x40, 0x86, 0x5e,
-	0x34, 0x2e, 0x11, 0x1f, 0x92, 0x47, 0xad, 0x1a, 0xb3, 0x85, 0xf0, 0x38, 0xd3, 0x7c, 0x7a, 0xb4,
-	0x85, 0x1a, 0xf1, 0x82, 0x26, 0xbf, 0x48, 0x2e, 0xc4, 0x82, 0xa8, 0x0c, 0xb9, 0x06, 0xf8, 0xb6,
-	0xec, 0xa2, 0xc4, 0xd7, 0x6f, 0x8d, 0x0e, 0xc6, 0xef, 0x68, 0xae, 0xb6, 0x2b, 0x3e, 0x7c, 0x55,
-	0x72, 0x0c, 0x88, 0x1e, 0x83, 0xfd, 0xaa, 0x64, 0x3e, 0x38, 0x6f, 0x8e, 0x4e, 0x07, 0x8f, 0x94,
-	0x31, 0x3d, 0x7a, 0x39, 0xb0, 0xa2, 0xd7, 0x10, 0x9e, 0x34, 0x32, 0x91, 0x59, 0xb1, 0xac, 0x77,
-	0x24, 0x61, 0xed, 0x4a, 0x62, 0x04, 0x1d, 0x81, 0xe9, 0xda, 0xe7, 0xcf, 0xee, 0xdf, 0xc4, 0x75,
-	0x40, 0xf4, 0x23, 0x04, 0xaf, 0xab, 0xa2, 0x2c, 0x6a, 0xd4, 0xf7, 0x46, 0x73, 0x7d, 0xd2, 0xdc,
-	0x17, 0x10, 0xe6, 0xed, 0x6d, 0xc4, 0x55, 0x77, 0xfc, 0x96, 0x99, 0x6f, 0xeb, 0xe6, 0x9b, 0x08,
-	0xf6, 0x25, 0x40, 0xbe, 0x9e, 0x3b, 0xd1, 0xb8, 0x4f, 0x0f, 0x5b, 0x31, 0xd1, 0x08, 0xec, 0xe3,
-	0x73, 0xf5, 0xd0, 0xae, 0xc5, 0xaa, 0x5d, 0xee, 0x68, 0x6e, 0x3f, 0x3d, 0xbd, 0xee, 0xa3, 0x31,
-	0x46, 0x4e, 0xf6, 0x44, 0xa2, 0x66, 0x66, 0x57, 0x62, 0x76, 0x5d, 0x37, 0xb9, 0x09, 0x5f, 0xe3,
-	0x68, 0x0a, 0xe1, 0x73, 0xc5, 0xc7, 0xb1, 0x58, 0x3d, 0x48, 0xd6, 0x07, 0xe0, 0x62, 0xaa, 0x96,
-	0xab, 0x40, 0x57, 0x7c, 0x3c, 0xe1, 0xe4, 0xfd, 0x76, 0xf0, 0xfb, 0x3f, 0x4f, 0xad, 0x3f, 0xf1,
-	0xf7, 0x37, 0xfe, 0x7e, 0xf9, 0xf7, 0xe9, 0xa3, 0x0b, 0x8f, 0xfe, 0x7d, 0x7d, 0xf5, 0x5f, 0x00,
-	0x00, 0x00, 0xff, 0xff, 0xce, 0x14, 0xe4, 0xe1, 0xcc, 0x06, 0x00, 0x00,
+	// 891 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x09, 0x6e, 0x88, 0x02, 0xff, 0x94, 0x55, 0xdb, 0x8e, 0xdc, 0x44,
+	0x10, 0xc5, 0x97, 0xf1, 0xa5, 0x66, 0x26, 0x8c, 0x5a, 0x10, 0x9c, 0x05, 0xc4, 0xc8, 0xd1, 0x22,
+	0x83, 0xc4, 0x0a, 0x6d, 0x90, 0x78, 0x0e, 0x3b, 0x4b, 0x14, 0x6d, 0x96, 0x84, 0xce, 0xe5, 0xd5,
+	0xea, 0x75, 0xf7, 0xec, 0x5a, 0xe3, 0x19, 0x9b, 0x76, 0x7b, 0x94, 0x11, 0x1f, 0xc0, 0x27, 0xf0,
+	0x84, 0xc4, 0xf7, 0xf0, 0x13, 0xfc, 0x0a, 0xea, 0xea, 0xf6, 0x5c, 0x92, 0x51, 0x24, 0xde, 0xea,
+	0x54, 0x57, 0x57, 0x57, 0x9d, 0x3a, 0x2e, 0x03, 0x28, 0xd6, 0x2e, 0xce, 0x1a, 0x59, 0xab, 0x9a,
+	0xf8, 0xda, 0x4e, 0x4f, 0xc0, 0x7f, 0x56, 0xb6, 0x8a, 0x10, 0xf0, 0xbb, 0x92, 0xb7, 0x89, 0x33,
+	0xf5, 0xb2, 0x80, 0xa2, 0x9d, 0xfe, 0x00, 0x83, 0x37, 0xac, 0xea, 0x04, 0x99, 0x80, 0xb7, 0x66,
+	0x55, 0xe2, 0x4c, 0x9d, 0x6c, 0x44, 0xb5, 0x49, 0x1e, 0x40, 0xb4, 0x66, 0x55, 0xae, 0x36, 0x8d,
+	0x48, 0xdc, 0xa9, 0x93, 0x0d, 0x68, 0xb8, 0x66, 0xd5, 0xab, 0x4d, 0x23, 0xd2, 0x7f, 0x1c, 0x18,
+	0xfc, 0xda, 0x09, 0xb9, 0xd1, 0x39, 0x99, 0x52, 0x12, 0xef, 0xc5, 0x14, 0x6d, 0xf2, 0x09, 0x0c,
+	0x8a, 0xba, 0x5b, 0x29, 0x7b, 0xcb, 0x00, 0x72, 0x1f, 0x82, 0x7a, 0x3e, 0x6f, 0x85, 0x4a, 0x3c,
+	0x74, 0x5b, 0x44, 0x3e, 0x87, 0x98, 0xcd, 0x95, 0x90, 0x79, 0x57, 0xf2, 0xc4, 0x9f, 0x3a, 0x59,
+	0x40, 0x23, 0x74, 0xbc, 0x2e, 0xb9, 0xae, 0x81, 0xd7, 0xb9, 0xc9, 0x36, 0x98, 0x3a, 0x59, 0x44,
+	0x43, 0x5e, 0x5f, 0x60, 0xbe, 0xbe, 0x9b, 0x60, 0xd7, 0x8d, 0x0e, 0x6f, 0x65, 0x91, 0xcf, 0xbb,
+	0x55, 0x91, 0x84, 0x53, 0x2f, 0x8b, 0x69, 0xd8, 0xca, 0xe2, 0xe7, 0x6e, 0x55, 0x90, 0x04, 0x42,
+	0x29, 0xd6, 0x42, 0xb6, 0x22, 0x89, 0x4c, 0x22, 0x0b, 0xd3, 0x3f, 0x1d, 0x08, 0xa8, 0x68, 0xbb,
+	0x4a, 0x91, 0x6f, 0x00, 0xba, 0x92, 0xe7, 0x4b, 0xa6, 0x64, 0xf9, 0x16, 0x79, 0x1a, 0x9e, 0xc3,
+	0x19, 0x12, 0xaa, 0x19, 0xa4, 0x71, 0x57, 0xf2, 0x6b, 0x3c, 0x24, 0x0f, 0x21, 0x58, 0x6b, 0xe2,
+	0xda, 0xc4, 0xc5, 0xb0, 0xa1, 0x09, 0x43, 0x32, 0xa9, 0x3d, 0xd2, 0x3d, 0x63, 0xed, 0x6d, 0xe2,
+	0x4d, 0xbd, 0x6c, 0x4c, 0x2d, 0x22, 0xa7, 0x70, 0xaf, 0x5c, 0x29, 0xfd, 0x7a, 0xa1, 0x72, 0x2e,
+	0x5a, 0x85, 0x8d, 0x47, 0x74, 0xbc, 0xf5, 0xce, 0x44, 0xab, 0xd2, 0x3f, 0x1c, 0xf0, 0x5f, 0xd6,
+	0x52, 0x1d, 0x65, 0xf9, 0xb0, 0x56, 0xf7, 0x43, 0xb5, 0x6e, 0x07, 0xe2, 0x1d, 0x1f, 0x88, 0x7f,
+	0x30, 0x10, 0x02, 0x3e, 0x17, 0x6d, 0x61, 0xf9, 0x46, 0x3b, 0xfd, 0x11, 0x40, 0x17, 0xf2, 0xbf,
+	0x69, 0x4a, 0x1f, 0x83, 0xf7, 0x4b, 0xb7, 0xd4, 0x15, 0xdc, 0xca, 0xba, 0x6b, 0xb0, 0x83, 0x31,
+	0x35, 0xa0, 0xd7, 0x9c, 0x96, 0x89, 0x67, 0x34, 0xd7, 0x0f, 0x55, 0xd3, 0xe5, 0x5b, 0x89, 0x3e,
+	0x81, 0x21, 0x65, 0x73, 0x75, 0x51, 0xaf, 0x94, 0x78, 0xab, 0xc8, 0x3d, 0x70, 0x4b, 0x8e, 0x79,
+	0x02, 0xea, 0x96, 0x7c, 0x97, 0xda, 0xdd, 0x4f, 0xad, 0x19, 0xe3, 0x5c, 0x62, 0xc7, 0x9a, 0x31,
+	0xce, 0x65, 0xfa, 0x97, 0x03, 0x70, 0x2d, 0x96, 0x37, 0x42, 0xb6, 0x77, 0x65, 0xf3, 0x5e, 0xa2,
+	0x07, 0x10, 0xe1, 0xdd, 0xbc, 0xe4, 0x36, 0x57, 0x88, 0xf8, 0x29, 0x3f, 0x96, 0x4d, 0xd3, 0x57,
+	0x09, 0xc6, 0x85, 0xb4, 0xb3, 0xb3, 0x88, 0x7c, 0x06, 0x21, 0x5b, 0xe6, 0x5c, 0x30, 0x6e, 0x19,
+	0x0c, 0xd8, 0x72, 0x26, 0x18, 0x27, 0x5f, 0xc1, 0xb0, 0x62, 0xad, 0xca, 0xbb, 0x86, 0x33, 0x25,
+	0x92, 0x60, 0xea, 0x64, 0x3e, 0x05, 0xed, 0x7a, 0x8d, 0x9e, 0xf4, 0x6f, 0x07, 0x26, 0xbb, 0xfa,
+	0x8c, 0x93, 0x7c, 0x0b, 0xe1, 0xd2, 0xf8, 0x2c, 0xd1, 0x13, 0x43, 0xf4, 0x2e, 0x90, 0xf6, 0x01,
+	0xef, 0xbe, 0xe0, 0xbe, 0xfb, 0x02, 0x39, 0x81, 0x48, 0x0a, 0x5e, 0x4a, 0x51, 0x18, 0x2d, 0x44,
+	0x74, 0x8b, 0xc9, 0x43, 0x18, 0xf7, 0x76, 0x8e, 0xcd, 0xfa, 0xd8, 0xec, 0xa8, 0x77, 0x3e, 0xd6,
+	0x14, 0xfe, 0xeb, 0xc0, 0x68, 0x86, 0x50, 0xf0, 0x4b, 0x7e, 0x2b, 0x34, 0x0b, 0x62, 0xa5, 0x4a,
+	0xb5, 0xb1, 0x44, 0x5a, 0xb4, 0x55, 0xac, 0x7b, 0xb8, 0x17, 0xf0, 0xbb, 0xc0, 0xa7, 0x47, 0xd4,
+	0x00, 0xf2, 0x25, 0x00, 0x1a, 0x66, 0xd1, 0xf8, 0x48, 0x7c, 0x8c, 0x1e, 0xbd, 0x6a, 0xec, 0x16,
+	0xea, 0x84, 0x9e, 0xca, 0x00, 0x9f, 0x08, 0x11, 0x3f, 0xc5, 0xc9, 0x57, 0xec, 0x46, 0x54, 0x48,
+	0x65, 0x4c, 0x0d, 0x20, 0xa7, 0xe0, 0xd6, 0x4d, 0x12, 0x4e, 0x9d, 0xec, 0xde, 0xf9, 0xa7, 0x86,
+	0xab, 0xfd, 0x8a, 0xcf, 0x9e, 0x37, 0xd4, 0xad, 0x9b, 0xf4, 0x3e, 0xb8, 0xcf, 0x1b, 0x12, 0x82,
+	0xf7, 0xf2, 0xf2, 0xd5, 0xe4, 0x23, 0x6d, 0xcc, 0x2e, 0x9f, 0x4d, 0x9c, 0xf4, 0x05, 0xc4, 0xd7,
+	0x9d, 0x62, 0xaa, 0xac, 0x57, 0xed, 0x81, 0x24, 0x9c, 0x43, 0x49, 0x64, 0x30, 0x10, 0xfc, 0x76,
+	0xfb, 0xf9, 0x93, 0xf7, 0x5f, 0xa2, 0x26, 0x20, 0xfd, 0x1d, 0xa2, 0x17, 0xb2, 0x6e, 0xea, 0x96,
+	0x55, 0x7b, 0x9a, 0x1b, 0xa3, 0xe6, 0xbe, 0x83, 0x78, 0xd9, 0xbf, 0x86, 0x5c, 0x0d, 0xcf, 0x3f,
+	0xb6, 0xf3, 0xed, 0xdd, 0x74, 0x17, 0x41, 0xbe, 0x07, 0x58, 0x6e, 0xe7, 0x8e, 0x34, 0x1e, 0xd3,
+	0xc3, 0x5e, 0x4c, 0x9a, 0x81, 0x7b, 0xf5, 0x46, 0x7f, 0x68, 0x0b, 0xb1, 0xe9, 0x97, 0xfb, 0x42,
+	0x6c, 0xf6, 0x3f, 0x3d, 0xb3, 0xee, 0xd3, 0x73, 0x70, 0xaf, 0x2e, 0x8e, 0x44, 0x9e, 0x40, 0x54,
+	0xdc, 0x89, 0x62, 0xd1, 0x76, 0x4b, 0x1b, 0xbe, 0xc5, 0xe9, 0x0c, 0xe2, 0x27, 0x9a, 0x8f, 0x2b,
+	0xb1, 0xf9, 0x20, 0x59, 0x5f, 0x80, 0xbf, 0x10, 0x9b, 0x9e, 0xab, 0xc8, 0x54, 0x7c, 0x75, 0x41,
+	0xd1, 0x9b, 0x3e, 0x02, 0xf8, 0x89, 0xa9, 0xe2, 0xce, 0xfc, 0x51, 0x4e, 0x21, 0xfc, 0xad, 0x13,
+	0xb2, 0x14, 0xbd, 0xe0, 0xed, 0x66, 0xc5, 0x53, 0xda, 0x9f, 0xa5, 0xd7, 0x30, 0xc4, 0x4b, 0x76,
+	0x25, 0x7d, 0xad, 0xd7, 0xbb, 0xb6, 0xfa, 0x5b, 0x23, 0x73, 0xcb, 0x1c, 0xd3, 0xfe, 0x10, 0xf5,
+	0x2a, 0x65, 0x2d, 0x4d, 0x2d, 0x31, 0xb5, 0xe8, 0x26, 0xc0, 0x1f, 0xe6, 0xa3, 0xff, 0x02, 0x00,
+	0x00, 0xff, 0xff, 0x46, 0x06, 0x2f, 0xa3, 0x3e, 0x07, 0x00, 0x00,
 }
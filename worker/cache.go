@@ -0,0 +1,289 @@
+/*
+ * Copyright 2016 DGraph Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * 		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package worker
+
+import (
+	"container/list"
+	"expvar"
+	"flag"
+	"sync"
+
+	farm "github.com/dgryski/go-farm"
+
+	"github.com/dgraph-io/dgraph/task"
+	"github.com/dgraph-io/dgraph/x"
+)
+
+var (
+	taskCacheMB = flag.Int("task_cache_mb", 64,
+		"Memory budget in MB for caching the results of task queries served by"+
+			" this instance. Zero disables the cache.")
+
+	// taskCacheStats is exported at /debug/vars.
+	taskCacheStats = expvar.NewMap("worker_task_cache")
+)
+
+// entryOverhead is roughly the memory used by an entry besides its result:
+// the entry itself, its list element and its map slot.
+const entryOverhead = 160
+
+type cacheKey struct {
+	lo, hi uint64
+}
+
+type cacheEntry struct {
+	key   cacheKey
+	attr  string
+	index uint64 // Applied RAFT index of the group, before the result was computed.
+	epoch uint64
+	// result is only read after the entry is stored. Callers get copies of it.
+	result *task.Result
+	size   int
+}
+
+// resultCache is an LRU cache of task results, bounded by the memory they use.
+//
+// An entry is tagged with the applied RAFT index of its group from before the
+// result was computed. Before applying a mutation, runMutations records its
+// index against each predicate it touches. An entry is only served while no
+// mutation after its index has touched its predicate. Writes which don't go
+// through RAFT clear the whole cache.
+type resultCache struct {
+	sync.Mutex
+	size    int
+	epoch   uint64 // Incremented by clear, so results being computed aren't stored.
+	ll      *list.List
+	m       map[cacheKey]*list.Element
+	touched map[string]uint64 // Index of the last mutation to each predicate.
+
+	// applied returns the applied index of a group served by this instance. It
+	// can be replaced in tests.
+	applied func(gid uint32) (uint64, bool)
+}
+
+var taskCache = newResultCache()
+
+func init() {
+	taskCacheStats.Set("bytes", expvar.Func(func() interface{} {
+		taskCache.Lock()
+		defer taskCache.Unlock()
+		return taskCache.size
+	}))
+	taskCacheStats.Set("entries", expvar.Func(func() interface{} {
+		taskCache.Lock()
+		defer taskCache.Unlock()
+		return taskCache.ll.Len()
+	}))
+}
+
+func newResultCache() *resultCache {
+	return &resultCache{
+		ll:      list.New(),
+		m:       make(map[cacheKey]*list.Element),
+		touched: make(map[string]uint64),
+		applied: appliedIndex,
+	}
+}
+
+func appliedIndex(gid uint32) (uint64, bool) {
+	if groups() == nil {
+		return 0, false
+	}
+	n := groups().Node(gid)
+	if n == nil {
+		return 0, false
+	}
+	return n.applied.DoneUntil(), true
+}
+
+func queryKey(q *task.Query) cacheKey {
+	data, err := q.Marshal()
+	x.Check(err)
+	lo, hi := farm.Fingerprint128(data)
+	return cacheKey{lo: lo, hi: hi}
+}
+
+// valid returns whether e can still be served. It must be called with the lock held.
+func (c *resultCache) valid(e *cacheEntry) bool {
+	return e.epoch == c.epoch && c.touched[e.attr] <= e.index
+}
+
+// get returns the cached result for key. On a miss, it returns the epoch to
+// store the result with.
+func (c *resultCache) get(key cacheKey) (*task.Result, uint64, bool) {
+	c.Lock()
+	epoch := c.epoch
+	elem, has := c.m[key]
+	if !has {
+		c.Unlock()
+		taskCacheStats.Add("misses", 1)
+		return nil, epoch, false
+	}
+	e := elem.Value.(*cacheEntry)
+	if !c.valid(e) {
+		c.remove(elem)
+		c.Unlock()
+		taskCacheStats.Add("invalidations", 1)
+		taskCacheStats.Add("misses", 1)
+		return nil, epoch, false
+	}
+	c.ll.MoveToFront(elem)
+	c.Unlock()
+
+	// Callers can modify the result, so give each of them its own copy.
+	taskCacheStats.Add("hits", 1)
+	return copyResult(e.result), epoch, true
+}
+
+func (c *resultCache) put(e *cacheEntry) {
+	c.Lock()
+	defer c.Unlock()
+	maxSize := *taskCacheMB << 20
+	// Don't let a single result push out a large part of the cache.
+	if e.size > maxSize/16 || !c.valid(e) {
+		return
+	}
+	if elem, has := c.m[e.key]; has {
+		c.remove(elem)
+	}
+	c.m[e.key] = c.ll.PushFront(e)
+	c.size += e.size
+	for c.size > maxSize {
+		c.remove(c.ll.Back())
+		taskCacheStats.Add("evictions", 1)
+	}
+}
+
+func (c *resultCache) remove(elem *list.Element) {
+	e := c.ll.Remove(elem).(*cacheEntry)
+	delete(c.m, e.key)
+	c.size -= e.size
+}
+
+// touch records that the mutation at the given index is about to change the
+// predicates of edges.
+func (c *resultCache) touch(index uint64, edges []*task.DirectedEdge) {
+	c.Lock()
+	defer c.Unlock()
+	for _, edge := range edges {
+		if index > c.touched[edge.Attr] {
+			c.touched[edge.Attr] = index
+		}
+	}
+}
+
+// clear drops all the entries, including the ones being computed.
+func (c *resultCache) clear() {
+	c.Lock()
+	defer c.Unlock()
+	c.epoch++
+	c.ll.Init()
+	c.m = make(map[cacheKey]*list.Element)
+	c.size = 0
+}
+
+// processTaskWithCache returns the result of q from the cache if it's still
+// valid, and otherwise processes q and caches the result.
+func processTaskWithCache(q *task.Query, gid uint32) (*task.Result, error) {
+	if *taskCacheMB <= 0 {
+		return processTask(q, gid)
+	}
+	index, ok := taskCache.applied(gid)
+	if !ok {
+		return processTask(q, gid)
+	}
+
+	key := queryKey(q)
+	r, epoch, hit := taskCache.get(key)
+	if hit {
+		return r, nil
+	}
+	r, err := processTask(q, gid)
+	if err != nil {
+		return r, err
+	}
+	cr := copyResult(r)
+	taskCache.put(&cacheEntry{
+		key:    key,
+		attr:   q.Attr,
+		index:  index,
+		epoch:  epoch,
+		result: cr,
+		size:   entryOverhead + len(q.Attr) + resultSize(cr),
+	})
+	return r, nil
+}
+
+// resultSize returns roughly the memory used by a result from copyResult.
+func resultSize(r *task.Result) int {
+	size := 64 + 48*len(r.UidMatrix) + 40*len(r.Values) + 4*len(r.Counts)
+	for _, l := range r.UidMatrix {
+		size += 8 * len(l.Uids)
+	}
+	for _, v := range r.Values {
+		size += len(v.Val)
+	}
+	return size
+}
+
+// copyResult returns a deep copy of r. The uids and values of all the lists
+// share one allocation each.
+func copyResult(r *task.Result) *task.Result {
+	out := &task.Result{IntersectDest: r.IntersectDest}
+	if r.Counts != nil {
+		out.Counts = append([]uint32{}, r.Counts...)
+	}
+
+	if r.UidMatrix != nil {
+		var n int
+		for _, l := range r.UidMatrix {
+			n += len(l.Uids)
+		}
+		uids := make([]uint64, 0, n)
+		lists := make([]task.List, len(r.UidMatrix))
+		out.UidMatrix = make([]*task.List, len(r.UidMatrix))
+		for i, l := range r.UidMatrix {
+			if l.Uids != nil {
+				start := len(uids)
+				uids = append(uids, l.Uids...)
+				// Cap the list, so appending to it doesn't overwrite the next one.
+				lists[i].Uids = uids[start:len(uids):len(uids)]
+			}
+			out.UidMatrix[i] = &lists[i]
+		}
+	}
+
+	if r.Values != nil {
+		var n int
+		for _, v := range r.Values {
+			n += len(v.Val)
+		}
+		buf := make([]byte, 0, n)
+		vals := make([]task.Value, len(r.Values))
+		out.Values = make([]*task.Value, len(r.Values))
+		for i, v := range r.Values {
+			vals[i].ValType = v.ValType
+			if v.Val != nil {
+				start := len(buf)
+				buf = append(buf, v.Val...)
+				vals[i].Val = buf[start:len(buf):len(buf)]
+			}
+			out.Values[i] = &vals[i]
+		}
+	}
+	return out
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright 2016 DGraph Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * 		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package worker
+
+import (
+	"expvar"
+	"fmt"
+	"os"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+
+	"github.com/dgraph-io/dgraph/algo"
+	"github.com/dgraph-io/dgraph/bench"
+	"github.com/dgraph-io/dgraph/task"
+	"github.com/dgraph-io/dgraph/x"
+)
+
+func cacheStat(name string) int64 {
+	if v, ok := taskCacheStats.Get(name).(*expvar.Int); ok {
+		return v.Value()
+	}
+	return 0
+}
+
+// useTestCache replaces taskCache with an empty cache, for which the applied
+// index of every group is *index.
+func useTestCache(index *uint64) func() {
+	old := taskCache
+	taskCache = newResultCache()
+	taskCache.applied = func(gid uint32) (uint64, bool) { return *index, true }
+	return func() { taskCache = old }
+}
+
+func TestProcessTaskWithCache(t *testing.T) {
+	dir, ps := initTest(t, `scalar friend:string @index`)
+	defer os.RemoveAll(dir)
+	defer ps.Close()
+	index := uint64(10)
+	defer useTestCache(&index)()
+
+	query := newQuery("friend", []uint64{10, 11, 12}, nil)
+	hits, misses := cacheStat("hits"), cacheStat("misses")
+	r, err := processTaskWithCache(query, 0)
+	require.NoError(t, err)
+	require.EqualValues(t, misses+1, cacheStat("misses"))
+
+	r2, err := processTaskWithCache(query, 0)
+	require.NoError(t, err)
+	require.EqualValues(t, hits+1, cacheStat("hits"))
+	require.Equal(t, r, r2)
+
+	// Each caller gets its own copy.
+	r2.UidMatrix[0].Uids[0] = 1000
+	r2.UidMatrix[1].Uids = append(r2.UidMatrix[1].Uids, 1001)
+	r2.Values[2].Val[0] = 'x'
+	r.UidMatrix[2].Uids[0] = 1002
+	r3, err := processTaskWithCache(query, 0)
+	require.NoError(t, err)
+	require.Equal(t, r2.Values[0], r3.Values[0])
+	require.EqualValues(t, [][]uint64{
+		[]uint64{23, 31},
+		[]uint64{23},
+		[]uint64{23, 25, 26, 31},
+	}, algo.ToUintsListForTest(r3.UidMatrix))
+	require.Equal(t, "photon", string(r3.Values[2].Val))
+
+	// A different query is a different entry.
+	_, err = processTaskWithCache(newQuery("friend", []uint64{10}, nil), 0)
+	require.NoError(t, err)
+	require.EqualValues(t, misses+2, cacheStat("misses"))
+}
+
+func TestProcessTaskWithCacheInvalidation(t *testing.T) {
+	dir, ps := initTest(t, `scalar friend:string @index`)
+	defer os.RemoveAll(dir)
+	defer ps.Close()
+	index := uint64(10)
+	defer useTestCache(&index)()
+
+	query := newQuery("friend", []uint64{10, 11, 12}, nil)
+	_, err := processTaskWithCache(query, 0)
+	require.NoError(t, err)
+
+	// A mutation to another predicate doesn't affect the entry.
+	other := []*task.DirectedEdge{{Entity: 10, Attr: "follows", ValueId: 5}}
+	taskCache.touch(11, other)
+	hits := cacheStat("hits")
+	_, err = processTaskWithCache(query, 0)
+	require.NoError(t, err)
+	require.EqualValues(t, hits+1, cacheStat("hits"))
+
+	edge := &task.DirectedEdge{Entity: 11, Attr: "friend", ValueId: 40, Label: "author0"}
+	taskCache.touch(12, []*task.DirectedEdge{edge})
+	addEdge(t, edge, getOrCreate(x.DataKey("friend", 11)))
+
+	invalidations := cacheStat("invalidations")
+	r, err := processTaskWithCache(query, 0)
+	require.NoError(t, err)
+	require.EqualValues(t, invalidations+1, cacheStat("invalidations"))
+	require.EqualValues(t, []uint64{23, 40}, algo.ToUintsListForTest(r.UidMatrix)[1])
+
+	// Until the mutation is applied, results aren't stored.
+	r, err = processTaskWithCache(query, 0)
+	require.NoError(t, err)
+	require.EqualValues(t, invalidations+1, cacheStat("invalidations"))
+	require.Equal(t, 0, taskCache.ll.Len())
+
+	// Once it's applied, results get cached again.
+	index = 12
+	_, err = processTaskWithCache(query, 0)
+	require.NoError(t, err)
+	hits = cacheStat("hits")
+	r, err = processTaskWithCache(query, 0)
+	require.NoError(t, err)
+	require.EqualValues(t, hits+1, cacheStat("hits"))
+	require.EqualValues(t, []uint64{23, 40}, algo.ToUintsListForTest(r.UidMatrix)[1])
+}
+
+func TestResultCacheBounded(t *testing.T) {
+	defer func(old int) { *taskCacheMB = old }(*taskCacheMB)
+	*taskCacheMB = 1
+	c := newResultCache()
+
+	evictions := cacheStat("evictions")
+	for i := uint64(0); i < 200; i++ {
+		c.put(&cacheEntry{key: cacheKey{lo: i}, attr: "friend", size: 10 << 10})
+	}
+	require.True(t, c.size <= 1<<20)
+	require.Equal(t, len(c.m), c.ll.Len())
+	require.True(t, cacheStat("evictions") > evictions)
+	// The most recent entries are kept.
+	_, has := c.m[cacheKey{lo: 199}]
+	require.True(t, has)
+	_, has = c.m[cacheKey{lo: 0}]
+	require.False(t, has)
+
+	// Too large to cache.
+	c.put(&cacheEntry{key: cacheKey{lo: 1000}, attr: "friend", size: 100 << 10})
+	_, has = c.m[cacheKey{lo: 1000}]
+	require.False(t, has)
+}
+
+func TestResultCacheClear(t *testing.T) {
+	c := newResultCache()
+	_, epoch, hit := c.get(cacheKey{lo: 1})
+	require.False(t, hit)
+
+	// Cleared while the result was being computed.
+	c.clear()
+	c.put(&cacheEntry{key: cacheKey{lo: 1}, attr: "friend", epoch: epoch,
+		result: &task.Result{}})
+	_, _, hit = c.get(cacheKey{lo: 1})
+	require.False(t, hit)
+
+	_, epoch, _ = c.get(cacheKey{lo: 1})
+	c.put(&cacheEntry{key: cacheKey{lo: 1}, attr: "friend", epoch: epoch,
+		result: &task.Result{}})
+	_, _, hit = c.get(cacheKey{lo: 1})
+	require.True(t, hit)
+	c.clear()
+	require.Equal(t, 0, c.size)
+	_, _, hit = c.get(cacheKey{lo: 1})
+	require.False(t, hit)
+}
+
+// BenchmarkProcessTaskWithCache repeats the same 100 uid fan-out queries over
+// the synthetic graph, which are served from the cache after the first round.
+func BenchmarkProcessTaskWithCache(b *testing.B) {
+	g, cleanup := loadBenchGraph(b)
+	defer cleanup()
+	index := uint64(1)
+	defer useTestCache(&index)()
+
+	const numQueries = 100
+	queries := make([]*task.Query, numQueries)
+	for i := range queries {
+		queries[i] = newQuery("friend", g.Uids(fmt.Sprintf("src%d", i), 100), nil)
+	}
+	rec := bench.NewRecorder("worker/task/cached/uids=100", b.N)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		rec.Start()
+		if _, err := processTaskWithCache(queries[i%numQueries], 0); err != nil {
+			b.Fatal(err)
+		}
+		rec.Stop()
+	}
+	b.StopTimer()
+	rec.Report(b)
+}
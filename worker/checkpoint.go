@@ -0,0 +1,367 @@
+/*
+* Copyright 2016 DGraph Labs, Inc.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*         http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+ */
+
+package worker
+
+import (
+	"context"
+	"flag"
+	"hash/crc32"
+	"io"
+	"io/ioutil"
+	"os"
+	"path"
+	"path/filepath"
+
+	"github.com/dgraph-io/dgraph/group"
+	"github.com/dgraph-io/dgraph/posting"
+	"github.com/dgraph-io/dgraph/store"
+	"github.com/dgraph-io/dgraph/task"
+	"github.com/dgraph-io/dgraph/x"
+)
+
+var (
+	checkpointPath = flag.String("checkpoint", "checkpoint",
+		"Folder in which to stage RocksDB checkpoints. Keep it on the same"+
+			" filesystem as the posting store, so checkpoints can be hard linked.")
+	checkpointBootstrap = flag.Bool("checkpoint_bootstrap", true,
+		"Bring up new or lagging replicas by copying a RocksDB checkpoint from the"+
+			" leader, instead of streaming the posting lists key by key.")
+
+	castagnoli = crc32.MakeTable(crc32.Castagnoli)
+)
+
+// checkpointChunkSize is the maximum size of data carried by one CheckpointChunk.
+const checkpointChunkSize = 4 * MB
+
+// minCheckpointShare is the smallest fraction of the posting store which a group
+// must take up for PredicateCheckpoint to send it. A checkpoint holds the data of
+// every group served by the leader, while the follower only keeps one of them.
+// Below this, streaming the group's keys copies less.
+const minCheckpointShare = 0.5
+
+// groupSize returns roughly the space used by the posting lists of group gid,
+// and by all the posting lists in the store. It seeks once per predicate.
+func groupSize(gid uint32) (size, total uint64) {
+	it := pstore.NewIterator()
+	defer it.Close()
+	for it.SeekToFirst(); it.Valid(); {
+		k := it.Key().Data()
+		pk := x.Parse(k)
+		if pk == nil {
+			it.Next()
+			continue
+		}
+		// All the keys of a predicate are contiguous, and k is the first of them.
+		limit := pk.SkipPredicate()
+		sz := pstore.ApproximateSize(k, limit)
+		total += sz
+		if group.BelongsTo(pk.Attr) == gid {
+			size += sz
+		}
+		it.Seek(limit)
+	}
+	return size, total
+}
+
+// takeCheckpoint creates a RocksDB checkpoint of pstore. The returned directory
+// and its parent should be removed by calling cleanup once done.
+func takeCheckpoint() (dir string, cleanup func(), rerr error) {
+	if err := os.MkdirAll(*checkpointPath, 0700); err != nil {
+		return "", nil, err
+	}
+	tmp, err := ioutil.TempDir(*checkpointPath, "leader")
+	if err != nil {
+		return "", nil, err
+	}
+	cleanup = func() { os.RemoveAll(tmp) }
+
+	cp, err := pstore.NewCheckpoint()
+	if err != nil {
+		cleanup()
+		return "", nil, err
+	}
+	defer cp.Destroy()
+
+	// Checkpoint.Save requires a directory which doesn't exist yet.
+	dir = path.Join(tmp, "db")
+	if err := cp.Save(dir); err != nil {
+		cleanup()
+		return "", nil, err
+	}
+	return dir, cleanup, nil
+}
+
+// sendCheckpointFile streams the file name within dir over stream, in chunks of
+// at most checkpointChunkSize bytes.
+func sendCheckpointFile(stream Worker_PredicateCheckpointServer, dir, name string,
+	index uint64) error {
+	f, err := os.Open(path.Join(dir, name))
+	if err != nil {
+		return err
+	}
+	defer f.Close()
+
+	buf := make([]byte, checkpointChunkSize)
+	var offset uint64
+	for {
+		n, err := io.ReadFull(f, buf)
+		if err != nil && err != io.EOF && err != io.ErrUnexpectedEOF {
+			return err
+		}
+		// Always send the first chunk, so empty files get created on the other side.
+		if n > 0 || offset == 0 {
+			chunk := &CheckpointChunk{
+				Name:     name,
+				Offset:   offset,
+				Data:     buf[:n],
+				Checksum: crc32.Checksum(buf[:n], castagnoli),
+				Index:    index,
+			}
+			if err := stream.Send(chunk); err != nil {
+				return err
+			}
+			offset += uint64(n)
+		}
+		if n < len(buf) {
+			return nil
+		}
+	}
+}
+
+// PredicateCheckpoint takes a RocksDB checkpoint of the posting store, and
+// streams all its files back. The files are immutable, so this is bounded by
+// disk and network bandwidth, instead of the per key cost of PredicateData.
+// The files hold every group in the store, so it refuses if the requested group
+// is less than minCheckpointShare of it, and the follower falls back to
+// PredicateData.
+func (w *grpcWorker) PredicateCheckpoint(req *CheckpointRequest,
+	stream Worker_PredicateCheckpointServer) error {
+	if !groups().ServesGroup(req.GroupId) {
+		return x.Errorf("Group %d not served.", req.GroupId)
+	}
+	n := groups().Node(req.GroupId)
+	if !n.AmLeader() {
+		return x.Errorf("Not leader of group: %d", req.GroupId)
+	}
+
+	size, total := groupSize(req.GroupId)
+	if float64(size) < minCheckpointShare*float64(total) {
+		return x.Errorf("Group %d is only %d of the %d bytes in the store. Not sending a checkpoint.",
+			req.GroupId, size, total)
+	}
+
+	// Everything until index has already been synced to RocksDB, so it would be
+	// part of the checkpoint. The receiver can replay RAFT entries from there.
+	index := posting.WaterMarkFor(req.GroupId).DoneUntil()
+	dir, cleanup, err := takeCheckpoint()
+	if err != nil {
+		return x.Wrapf(err, "While taking checkpoint for group: %d", req.GroupId)
+	}
+	defer cleanup()
+
+	files, err := ioutil.ReadDir(dir)
+	if err != nil {
+		return err
+	}
+	for _, fi := range files {
+		if fi.IsDir() {
+			continue
+		}
+		if err := sendCheckpointFile(stream, dir, fi.Name(), index); err != nil {
+			return x.Wrapf(err, "While sending checkpoint file: %s", fi.Name())
+		}
+	}
+	x.Trace(stream.Context(), "Sent %d checkpoint files for group: %d at index: %d",
+		len(files), req.GroupId, index)
+	return nil
+}
+
+// receiveCheckpoint writes the files streamed by PredicateCheckpoint to dir,
+// verifying the checksum of every chunk. It returns the RAFT index of the checkpoint.
+func receiveCheckpoint(stream Worker_PredicateCheckpointClient, dir string) (uint64, error) {
+	var f *os.File
+	var index uint64
+	defer func() {
+		if f != nil {
+			f.Close()
+		}
+	}()
+
+	for {
+		chunk, err := stream.Recv()
+		if err == io.EOF {
+			break
+		}
+		if err != nil {
+			return 0, err
+		}
+		if crc32.Checksum(chunk.Data, castagnoli) != chunk.Checksum {
+			return 0, x.Errorf("Checksum mismatch for file: %s at offset: %d",
+				chunk.Name, chunk.Offset)
+		}
+		// Checkpoints are flat. Don't let a bad name write outside of dir.
+		if chunk.Name != filepath.Base(chunk.Name) {
+			return 0, x.Errorf("Invalid checkpoint file name: %q", chunk.Name)
+		}
+
+		if f == nil || f.Name() != path.Join(dir, chunk.Name) {
+			if f != nil {
+				if err := f.Close(); err != nil {
+					return 0, err
+				}
+			}
+			if f, err = os.Create(path.Join(dir, chunk.Name)); err != nil {
+				return 0, err
+			}
+		}
+		if _, err := f.WriteAt(chunk.Data, int64(chunk.Offset)); err != nil {
+			return 0, err
+		}
+		index = chunk.Index
+	}
+
+	if f != nil {
+		err := f.Close()
+		f = nil
+		if err != nil {
+			return 0, err
+		}
+	}
+	return index, nil
+}
+
+// applyCheckpoint opens the checkpoint present in dir, and writes all the keys
+// belonging to group gid to pstore.
+func applyCheckpoint(ctx context.Context, dir string, gid uint32) (int, error) {
+	cs, err := store.NewReadOnlyStore(dir)
+	if err != nil {
+		return 0, err
+	}
+	defer cs.Close()
+
+	it := cs.NewIterator()
+	defer it.Close()
+
+	kvs := make(chan *task.KV, 1000)
+	che := make(chan error, 1)
+	go writeBatch(ctx, kvs, che)
+
+	count := 0
+	for it.SeekToFirst(); it.Valid(); it.Next() {
+		k, v := it.Key(), it.Value()
+		pk := x.Parse(k.Data())
+
+		if pk == nil {
+			continue
+		}
+		if group.BelongsTo(pk.Attr) != gid {
+			it.Seek(pk.SkipPredicate())
+			it.Prev() // To tackle it.Next() called by default.
+			continue
+		}
+
+		// The iterator owns the underlying memory, so copy before sending.
+		kv := &task.KV{
+			Key: make([]byte, len(k.Data())),
+			Val: make([]byte, len(v.Data())),
+		}
+		copy(kv.Key, k.Data())
+		copy(kv.Val, v.Data())
+
+		select {
+		case kvs <- kv:
+			count++
+		case err := <-che:
+			close(kvs)
+			return count, err
+		}
+	}
+	close(kvs)
+
+	if err := <-che; err != nil {
+		return count, err
+	}
+	return count, it.Err()
+}
+
+// populateShardFromCheckpoint copies a RocksDB checkpoint from the server
+// reachable via pl, and loads the data for group gid from it. It returns the
+// RAFT index at which the checkpoint was taken.
+func populateShardFromCheckpoint(ctx context.Context, pl *pool, gid uint32) (uint64, error) {
+	conn, err := pl.Get()
+	if err != nil {
+		return 0, err
+	}
+	defer pl.Put(conn)
+	c := NewWorkerClient(conn)
+
+	if err := os.MkdirAll(*checkpointPath, 0700); err != nil {
+		return 0, err
+	}
+	dir, err := ioutil.TempDir(*checkpointPath, "follower")
+	if err != nil {
+		return 0, err
+	}
+	defer os.RemoveAll(dir)
+
+	stream, err := c.PredicateCheckpoint(ctx, &CheckpointRequest{GroupId: gid})
+	if err != nil {
+		return 0, err
+	}
+	x.Trace(ctx, "Receiving checkpoint for group: %v", gid)
+	index, err := receiveCheckpoint(stream, dir)
+	if err != nil {
+		return 0, x.Wrapf(err, "While receiving checkpoint for group: %d", gid)
+	}
+
+	count, err := applyCheckpoint(ctx, dir, gid)
+	if err != nil {
+		return 0, x.Wrapf(err, "While applying checkpoint for group: %d", gid)
+	}
+	x.Trace(ctx, "Loaded %d keys from checkpoint for group: %v index: %v", count, gid, index)
+	return index, nil
+}
+
+// bootstrapShard brings the data for group gid up to speed with the server
+// reachable via pl. minIndex is the RAFT index the data must at least be at.
+// With --checkpoint_bootstrap, it copies a checkpoint, and falls back to
+// streaming the differing posting lists if that doesn't succeed.
+//
+// A read-only store can't be written to, so it's served as it is.
+func bootstrapShard(ctx context.Context, pl *pool, gid uint32, minIndex uint64) error {
+	if pstore.ReadOnly() {
+		x.Printf("Posting store is read-only. Not bootstrapping group %d to index: %d\n",
+			gid, minIndex)
+		return nil
+	}
+	// The posting lists are written straight to the store, without RAFT.
+	defer taskCache.clear()
+	if *checkpointBootstrap {
+		index, err := populateShardFromCheckpoint(ctx, pl, gid)
+		if err == nil && index >= minIndex {
+			x.Printf("Loaded group %d from checkpoint at index: %d\n", gid, index)
+			return nil
+		}
+		if err != nil {
+			x.Printf("Unable to load group %d from checkpoint: %v\n", gid, err)
+		} else {
+			x.Printf("Checkpoint index %d for group %d is behind %d\n", index, gid, minIndex)
+		}
+	}
+	_, err := populateShard(ctx, pl, gid)
+	return err
+}
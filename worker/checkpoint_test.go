@@ -0,0 +1,164 @@
+package worker
+
+import (
+	"context"
+	"io"
+	"io/ioutil"
+	"os"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+	"google.golang.org/grpc"
+
+	"github.com/dgraph-io/dgraph/group"
+	"github.com/dgraph-io/dgraph/store"
+	"github.com/dgraph-io/dgraph/x"
+)
+
+// chunkServer and chunkClient connect sendCheckpointFile to receiveCheckpoint
+// without a network.
+type chunkServer struct {
+	grpc.ServerStream
+	chunks []*CheckpointChunk
+}
+
+type chunkClient struct {
+	grpc.ClientStream
+	chunks []*CheckpointChunk
+}
+
+func (s *chunkServer) Send(c *CheckpointChunk) error {
+	cp := *c
+	cp.Data = append([]byte{}, c.Data...)
+	s.chunks = append(s.chunks, &cp)
+	return nil
+}
+
+func (s *chunkClient) Recv() (*CheckpointChunk, error) {
+	if len(s.chunks) == 0 {
+		return nil, io.EOF
+	}
+	c := s.chunks[0]
+	s.chunks = s.chunks[1:]
+	return c, nil
+}
+
+func newTestStore(t *testing.T) (string, *store.Store) {
+	dir, err := ioutil.TempDir("", "storetest_")
+	require.NoError(t, err)
+	ps, err := store.NewStore(dir)
+	require.NoError(t, err)
+	return dir, ps
+}
+
+func TestCheckpointTransfer(t *testing.T) {
+	group.ParseGroupConfig("groups.conf")
+	gid := group.BelongsTo("friend")
+	require.NotEqual(t, gid, group.BelongsTo("name"))
+
+	cpdir, err := ioutil.TempDir("", "checkpoint")
+	require.NoError(t, err)
+	defer os.RemoveAll(cpdir)
+	*checkpointPath = cpdir
+
+	dir1, ps1 := newTestStore(t)
+	defer os.RemoveAll(dir1)
+	defer ps1.Close()
+	for i := uint64(1); i <= 100; i++ {
+		require.NoError(t, ps1.SetOne(x.DataKey("friend", i), []byte("f")))
+		require.NoError(t, ps1.SetOne(x.DataKey("name", i), []byte("n")))
+	}
+
+	pstore = ps1
+	dir, cleanup, err := takeCheckpoint()
+	require.NoError(t, err)
+	defer cleanup()
+
+	files, err := ioutil.ReadDir(dir)
+	require.NoError(t, err)
+	server := new(chunkServer)
+	for _, fi := range files {
+		require.NoError(t, sendCheckpointFile(server, dir, fi.Name(), 7))
+	}
+
+	rdir, err := ioutil.TempDir(cpdir, "follower")
+	require.NoError(t, err)
+	index, err := receiveCheckpoint(&chunkClient{chunks: server.chunks}, rdir)
+	require.NoError(t, err)
+	require.EqualValues(t, 7, index)
+
+	dir2, ps2 := newTestStore(t)
+	defer os.RemoveAll(dir2)
+	defer ps2.Close()
+	pstore = ps2
+	count, err := applyCheckpoint(context.Background(), rdir, gid)
+	require.NoError(t, err)
+	require.Equal(t, 100, count)
+
+	it := ps2.NewIterator()
+	defer it.Close()
+	var keys int
+	for it.SeekToFirst(); it.Valid(); it.Next() {
+		pk := x.Parse(it.Key().Data())
+		require.Equal(t, "friend", pk.Attr)
+		keys++
+	}
+	require.Equal(t, 100, keys)
+}
+
+func TestGroupSize(t *testing.T) {
+	group.ParseGroupConfig("groups.conf")
+	gid := group.BelongsTo("friend")
+	require.NotEqual(t, gid, group.BelongsTo("name"))
+
+	dir, ps := newTestStore(t)
+	defer os.RemoveAll(dir)
+	defer ps.Close()
+	val := make([]byte, 1000)
+	for i := uint64(1); i <= 1000; i++ {
+		require.NoError(t, ps.SetOne(x.DataKey("friend", i), val))
+		if i <= 100 {
+			require.NoError(t, ps.SetOne(x.DataKey("name", i), val))
+		}
+	}
+	require.NoError(t, ps.Flush())
+
+	pstore = ps
+	size, total := groupSize(gid)
+	require.True(t, size > 0)
+	require.True(t, float64(size) > minCheckpointShare*float64(total))
+	size, total = groupSize(group.BelongsTo("name"))
+	require.True(t, size > 0)
+	require.True(t, float64(size) < minCheckpointShare*float64(total))
+}
+
+func TestBootstrapReadOnlyStore(t *testing.T) {
+	dir, ps := newTestStore(t)
+	defer os.RemoveAll(dir)
+	require.NoError(t, ps.SetOne(x.DataKey("friend", 1), []byte("f")))
+	ps.Close()
+
+	ro, err := store.NewMmapReadOnlyStore(dir, 1<<20)
+	require.NoError(t, err)
+	defer ro.Close()
+	defer func(old *store.Store) { pstore = old }(pstore)
+	pstore = ro
+
+	// There's no pool to bootstrap from. It must not be used.
+	require.NoError(t, bootstrapShard(context.Background(), nil, 1, 10))
+	val, err := ro.Get(x.DataKey("friend", 1))
+	require.NoError(t, err)
+	require.EqualValues(t, "f", val.Data())
+}
+
+func TestCheckpointBadChecksum(t *testing.T) {
+	dir, err := ioutil.TempDir("", "checkpoint")
+	require.NoError(t, err)
+	defer os.RemoveAll(dir)
+
+	stream := &chunkClient{chunks: []*CheckpointChunk{
+		{Name: "CURRENT", Data: []byte("MANIFEST-000001\n"), Checksum: 1},
+	}}
+	_, err = receiveCheckpoint(stream, dir)
+	require.Error(t, err)
+}
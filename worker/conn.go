@@ -7,6 +7,7 @@ import (
 	"fmt"
 	"log"
 	"sync"
+	"sync/atomic"
 
 	"github.com/dgraph-io/dgraph/x"
 
@@ -18,9 +19,12 @@ var (
 )
 
 // Pool is used to manage the grpc client connections for communicating with
-// other worker instances.
+// other worker instances. A grpc connection multiplexes concurrent calls, so the
+// pool holds a fixed set of long lived connections and hands them out round
+// robin, instead of dialing and closing connections on bursts of requests.
 type pool struct {
-	conns chan *grpc.ClientConn
+	conns []*grpc.ClientConn
+	next  uint32
 	Addr  string
 }
 
@@ -79,6 +83,7 @@ func (p *poolsi) connect(addr string) {
 	resp, err := c.Echo(context.Background(), query)
 	if err != nil {
 		log.Printf("While trying to connect to %q, got error: %v\n", addr, err)
+		pool.close()
 		return
 	}
 	x.AssertTrue(bytes.Equal(resp.Data, query.Data))
@@ -89,53 +94,54 @@ func (p *poolsi) connect(addr string) {
 	defer p.Unlock()
 	_, has = p.all[addr]
 	if has {
+		pool.close()
 		return
 	}
 	p.all[addr] = pool
 }
 
 // NewPool initializes an instance of Pool which is used to connect with other
-// workers. The pool instance also has a buffered channel,conn with capacity
-// maxCap that stores the connections.
+// workers. The pool instance dials maxCap connections, which are kept open for
+// its lifetime.
 func newPool(addr string, maxCap int) *pool {
 	p := new(pool)
 	p.Addr = addr
-	p.conns = make(chan *grpc.ClientConn, maxCap)
-	conn, err := p.dialNew()
-	if err != nil {
-		log.Fatal(err)
-		return nil
+	p.conns = make([]*grpc.ClientConn, 0, maxCap)
+	for i := 0; i < maxCap; i++ {
+		conn, err := p.dialNew()
+		if err != nil {
+			log.Fatal(err)
+			return nil
+		}
+		p.conns = append(p.conns, conn)
 	}
-	p.conns <- conn
 	return p
 }
 
+// close closes all the connections of a pool which isn't in use, so they stop
+// reconnecting in the background.
+func (p *pool) close() {
+	for _, conn := range p.conns {
+		conn.Close()
+	}
+}
+
 func (p *pool) dialNew() (*grpc.ClientConn, error) {
 	return grpc.Dial(p.Addr, grpc.WithInsecure())
 }
 
-// Get returns a connection from the pool of connections or a new connection if
-// the pool is empty.
+// Get returns the next connection from the pool of connections. The same
+// connection can be in use by many callers at the same time.
 func (p *pool) Get() (*grpc.ClientConn, error) {
-	if p == nil {
+	if p == nil || len(p.conns) == 0 {
 		return nil, errNoConnection
 	}
-
-	select {
-	case conn := <-p.conns:
-		return conn, nil
-	default:
-		return p.dialNew()
-	}
+	idx := atomic.AddUint32(&p.next, 1)
+	return p.conns[idx%uint32(len(p.conns))], nil
 }
 
-// Put returns a connection to the pool or closes and discards the connection
-// incase the pool channel is at capacity.
+// Put hands a connection back to the pool. Connections are shared and long
+// lived, so there's nothing to do here. It's kept so callers can pair it with Get.
 func (p *pool) Put(conn *grpc.ClientConn) error {
-	select {
-	case p.conns <- conn:
-		return nil
-	default:
-		return conn.Close()
-	}
+	return nil
 }
@@ -0,0 +1,309 @@
+/*
+ * Copyright 2016 DGraph Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * 		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package worker
+
+import (
+	"expvar"
+	"flag"
+	"fmt"
+	"sync"
+	"time"
+
+	"golang.org/x/net/context"
+
+	"github.com/dgraph-io/dgraph/group"
+	"github.com/dgraph-io/dgraph/task"
+	"github.com/dgraph-io/dgraph/x"
+)
+
+var (
+	taskBatchWindow = flag.Duration("task_batch_window", 200*time.Microsecond,
+		"When more than one query to the same remote group is queued up, wait this"+
+			" long for others to coalesce them into one RPC. A lone query is sent"+
+			" right away. Zero sends whatever is queued, without waiting.")
+	taskBatchSize = flag.Int("task_batch_size", 64,
+		"Maximum number of queries to send to a remote group in one RPC.")
+
+	// taskBatchStats is exported at /debug/vars. The average batch size and
+	// latency can be derived from the totals.
+	taskBatchStats = expvar.NewMap("worker_task_batch")
+)
+
+type taskReply struct {
+	result *task.Result
+	err    error
+}
+
+type taskRequest struct {
+	ctx   context.Context
+	query *task.Query
+	reply chan taskReply
+}
+
+// dispatcher coalesces the queries sent to a remote group, which are queued up
+// together, into a single ServeTaskBatch RPC. A query that finds the queue
+// empty is sent right away, so batching only adds latency under load.
+type dispatcher struct {
+	gid      uint32
+	requests chan *taskRequest
+	// call sends a batch over the network. It can be replaced in tests.
+	call func(ctx context.Context, gid uint32, bq *task.BatchQuery) (*task.BatchResult, error)
+}
+
+type dispatchers struct {
+	sync.RWMutex
+	all map[uint32]*dispatcher
+}
+
+var dis = &dispatchers{all: make(map[uint32]*dispatcher)}
+
+func newDispatcher(gid uint32) *dispatcher {
+	d := &dispatcher{
+		gid:      gid,
+		requests: make(chan *taskRequest, 1000),
+		call:     serveTaskBatchOverNetwork,
+	}
+	go d.run()
+	return d
+}
+
+// dispatcherFor returns the dispatcher for group gid, creating one if needed.
+func dispatcherFor(gid uint32) *dispatcher {
+	dis.RLock()
+	d, has := dis.all[gid]
+	dis.RUnlock()
+	if has {
+		return d
+	}
+
+	dis.Lock()
+	defer dis.Unlock()
+	if d, has := dis.all[gid]; has {
+		return d
+	}
+	d = newDispatcher(gid)
+	dis.all[gid] = d
+	return d
+}
+
+// process queues up q to be sent with the next batch, and waits for its result.
+func (d *dispatcher) process(ctx context.Context, q *task.Query) (*task.Result, error) {
+	req := &taskRequest{
+		ctx:   ctx,
+		query: q,
+		reply: make(chan taskReply, 1),
+	}
+	select {
+	case d.requests <- req:
+	case <-ctx.Done():
+		return &emptyResult, ctx.Err()
+	}
+
+	select {
+	case r := <-req.reply:
+		return r.result, r.err
+	case <-ctx.Done():
+		return &emptyResult, ctx.Err()
+	}
+}
+
+// drain appends the requests already queued up to batch, without blocking.
+func (d *dispatcher) drain(batch []*taskRequest) []*taskRequest {
+	for len(batch) < *taskBatchSize {
+		select {
+		case req := <-d.requests:
+			batch = append(batch, req)
+		default:
+			return batch
+		}
+	}
+	return batch
+}
+
+func (d *dispatcher) run() {
+	for req := range d.requests {
+		batch := d.drain([]*taskRequest{req})
+		// Only wait for more if others are sending to this group too.
+		if len(batch) > 1 && len(batch) < *taskBatchSize && *taskBatchWindow > 0 {
+			timer := time.NewTimer(*taskBatchWindow)
+		WAIT:
+			for len(batch) < *taskBatchSize {
+				select {
+				case req := <-d.requests:
+					batch = append(batch, req)
+				case <-timer.C:
+					break WAIT
+				}
+			}
+			timer.Stop()
+		}
+		go d.send(batch)
+	}
+}
+
+// batchDeadline returns the longest deadline among the requests. If any of
+// them has no deadline, neither does the batch.
+func batchDeadline(batch []*taskRequest) (time.Time, bool) {
+	var latest time.Time
+	for _, req := range batch {
+		dl, ok := req.ctx.Deadline()
+		if !ok {
+			return time.Time{}, false
+		}
+		if dl.After(latest) {
+			latest = dl
+		}
+	}
+	return latest, true
+}
+
+// batchContext returns a context which lives until the batch deadline. It's
+// also cancelled once the contexts of all the requests are done, as nobody is
+// waiting for the results then.
+func batchContext(batch []*taskRequest) (context.Context, context.CancelFunc) {
+	var ctx context.Context
+	var cancel context.CancelFunc
+	if dl, ok := batchDeadline(batch); ok {
+		ctx, cancel = context.WithDeadline(context.Background(), dl)
+	} else {
+		ctx, cancel = context.WithCancel(context.Background())
+	}
+	go func() {
+		for _, req := range batch {
+			select {
+			case <-req.ctx.Done():
+			case <-ctx.Done():
+				return
+			}
+		}
+		cancel()
+	}()
+	return ctx, cancel
+}
+
+func (d *dispatcher) send(batch []*taskRequest) {
+	bq := &task.BatchQuery{Queries: make([]*task.Query, 0, len(batch))}
+	for _, req := range batch {
+		bq.Queries = append(bq.Queries, req.query)
+	}
+
+	ctx, cancel := batchContext(batch)
+	defer cancel()
+	start := time.Now()
+	reply, err := d.call(ctx, d.gid, bq)
+	recordBatch(len(batch), time.Since(start), err)
+
+	if err == nil && len(reply.Results) != len(batch) {
+		err = x.Errorf("Sent %d queries to group %d, but got %d results",
+			len(batch), d.gid, len(reply.Results))
+	}
+	for i, req := range batch {
+		switch {
+		case err != nil:
+			req.reply <- taskReply{&emptyResult, err}
+		case i < len(reply.Errors) && len(reply.Errors[i]) > 0:
+			req.reply <- taskReply{&emptyResult, x.Errorf("%s", reply.Errors[i])}
+		default:
+			req.reply <- taskReply{reply.Results[i], nil}
+		}
+	}
+}
+
+// recordBatch updates the exported RPC batch size and latency metrics.
+func recordBatch(size int, latency time.Duration, err error) {
+	taskBatchStats.Add("rpcs", 1)
+	taskBatchStats.Add("queries", int64(size))
+	taskBatchStats.Add("latency_us", int64(latency/time.Microsecond))
+	if err != nil {
+		taskBatchStats.Add("errors", 1)
+	}
+	// Bucket the batch sizes by powers of two: 1, 2, 4, ...
+	bucket := 1
+	for bucket < size {
+		bucket <<= 1
+	}
+	taskBatchStats.Add(fmt.Sprintf("size_le_%d", bucket), 1)
+}
+
+func serveTaskBatchOverNetwork(ctx context.Context, gid uint32,
+	bq *task.BatchQuery) (*task.BatchResult, error) {
+	addr := groups().AnyServer(gid)
+	pl := pools().get(addr)
+
+	conn, err := pl.Get()
+	if err != nil {
+		return nil, x.Wrapf(err, "serveTaskBatchOverNetwork: while retrieving connection.")
+	}
+	defer pl.Put(conn)
+
+	c := NewWorkerClient(conn)
+	return c.ServeTaskBatch(ctx, bq)
+}
+
+// ServeTaskBatch is used to respond to a batch of queries. The queries are
+// processed concurrently.
+func (w *grpcWorker) ServeTaskBatch(ctx context.Context,
+	bq *task.BatchQuery) (*task.BatchResult, error) {
+	if ctx.Err() != nil {
+		return &task.BatchResult{}, ctx.Err()
+	}
+	x.Trace(ctx, "ServeTaskBatch with %d queries", len(bq.Queries))
+
+	results := make([]*task.Result, len(bq.Queries))
+	errs := make([]string, len(bq.Queries))
+	var wg sync.WaitGroup
+	for i, q := range bq.Queries {
+		wg.Add(1)
+		go func(i int, q *task.Query) {
+			defer wg.Done()
+			results[i] = &emptyResult
+			gid := group.BelongsTo(q.Attr)
+			if !groups().ServesGroup(gid) {
+				errs[i] = fmt.Sprintf("attr: %q groupId: %v Request sent to wrong server.",
+					q.Attr, gid)
+				return
+			}
+			r, err := processTaskWithCache(q, gid)
+			if err != nil {
+				errs[i] = err.Error()
+				return
+			}
+			results[i] = r
+		}(i, q)
+	}
+
+	done := make(chan struct{})
+	go func() {
+		wg.Wait()
+		close(done)
+	}()
+	select {
+	case <-ctx.Done():
+		return &task.BatchResult{}, ctx.Err()
+	case <-done:
+	}
+
+	out := &task.BatchResult{Results: results}
+	for _, e := range errs {
+		if len(e) > 0 {
+			// Only send the errors if there are any.
+			out.Errors = errs
+			break
+		}
+	}
+	return out, nil
+}
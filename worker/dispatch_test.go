@@ -0,0 +1,172 @@
+package worker
+
+import (
+	"errors"
+	"os"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/require"
+	"golang.org/x/net/context"
+
+	"github.com/dgraph-io/dgraph/algo"
+	"github.com/dgraph-io/dgraph/group"
+	"github.com/dgraph-io/dgraph/task"
+)
+
+func TestDispatcherCoalesces(t *testing.T) {
+	defer func(old time.Duration) { *taskBatchWindow = old }(*taskBatchWindow)
+	*taskBatchWindow = 50 * time.Millisecond
+	var calls, queries int
+	d := &dispatcher{
+		gid:      7,
+		requests: make(chan *taskRequest, 100),
+		call: func(ctx context.Context, gid uint32,
+			bq *task.BatchQuery) (*task.BatchResult, error) {
+			calls++
+			queries += len(bq.Queries)
+			br := &task.BatchResult{Errors: make([]string, len(bq.Queries))}
+			for i, q := range bq.Queries {
+				br.Results = append(br.Results, &task.Result{
+					UidMatrix: []*task.List{{Uids: q.Uids}},
+				})
+				if q.Attr == "bad" {
+					br.Errors[i] = "bad attr: 100%"
+				}
+			}
+			return br, nil
+		},
+	}
+
+	type result struct {
+		uid uint64
+		r   *task.Result
+		err error
+	}
+	results := make(chan result, 10)
+	for i := 1; i <= 10; i++ {
+		go func(uid uint64) {
+			attr := "friend"
+			if uid == 5 {
+				attr = "bad"
+			}
+			q := &task.Query{Attr: attr, Uids: []uint64{uid}}
+			r, err := d.process(context.Background(), q)
+			results <- result{uid, r, err}
+		}(uint64(i))
+	}
+	// Queue up all the queries before the dispatcher picks up the first one.
+	for len(d.requests) < 10 {
+		time.Sleep(time.Millisecond)
+	}
+	go d.run()
+	for i := 0; i < 10; i++ {
+		res := <-results
+		if res.uid == 5 {
+			require.Error(t, res.err)
+			// Remote errors are passed on verbatim.
+			require.Contains(t, res.err.Error(), "bad attr: 100%")
+			continue
+		}
+		require.NoError(t, res.err)
+		require.Equal(t, []uint64{res.uid}, res.r.UidMatrix[0].Uids)
+	}
+	require.Equal(t, 1, calls)
+	require.Equal(t, 10, queries)
+}
+
+func TestDispatcherCallError(t *testing.T) {
+	defer func(old time.Duration) { *taskBatchWindow = old }(*taskBatchWindow)
+	*taskBatchWindow = time.Millisecond
+	d := &dispatcher{
+		gid:      7,
+		requests: make(chan *taskRequest, 100),
+		call: func(ctx context.Context, gid uint32,
+			bq *task.BatchQuery) (*task.BatchResult, error) {
+			return nil, errors.New("unreachable")
+		},
+	}
+	go d.run()
+
+	_, err := d.process(context.Background(), &task.Query{Attr: "friend"})
+	require.Error(t, err)
+}
+
+func TestDispatcherLoneQuery(t *testing.T) {
+	defer func(old time.Duration) { *taskBatchWindow = old }(*taskBatchWindow)
+	*taskBatchWindow = time.Hour
+	d := &dispatcher{
+		gid:      7,
+		requests: make(chan *taskRequest, 100),
+		call: func(ctx context.Context, gid uint32,
+			bq *task.BatchQuery) (*task.BatchResult, error) {
+			return &task.BatchResult{Results: []*task.Result{&emptyResult}}, nil
+		},
+	}
+	go d.run()
+
+	// A query which finds the queue empty doesn't wait for the window.
+	ctx, cancel := context.WithTimeout(context.Background(), 5*time.Second)
+	defer cancel()
+	_, err := d.process(ctx, &task.Query{Attr: "friend"})
+	require.NoError(t, err)
+}
+
+func TestBatchContext(t *testing.T) {
+	ctx1, cancel1 := context.WithCancel(context.Background())
+	ctx2, cancel2 := context.WithTimeout(context.Background(), time.Hour)
+	batch := []*taskRequest{{ctx: ctx1}, {ctx: ctx2}}
+	ctx, cancel := batchContext(batch)
+	defer cancel()
+	_, ok := ctx.Deadline()
+	require.False(t, ok)
+
+	cancel1()
+	select {
+	case <-ctx.Done():
+		t.Fatal("Batch cancelled while a request is still waiting")
+	case <-time.After(10 * time.Millisecond):
+	}
+	cancel2()
+	select {
+	case <-ctx.Done():
+	case <-time.After(5 * time.Second):
+		t.Fatal("Batch not cancelled after all the requests were")
+	}
+}
+
+func TestServeTaskBatch(t *testing.T) {
+	dir, ps := initTest(t, `scalar friend:string @index`)
+	defer os.RemoveAll(dir)
+	defer ps.Close()
+	index := uint64(10)
+	defer useTestCache(&index)()
+
+	require.NoError(t, group.ParseGroupConfig("groups.conf"))
+	gid := group.BelongsTo("friend")
+	other := "a"
+	for group.BelongsTo(other) == gid {
+		other += "a"
+	}
+	defer func(old *groupi) { gr = old }(gr)
+	gr = &groupi{local: map[uint32]*node{gid: nil}}
+
+	bq := &task.BatchQuery{Queries: []*task.Query{
+		newQuery("friend", []uint64{12}, nil),
+		newQuery(other, []uint64{10}, nil),
+		newQuery("friend", []uint64{10, 11}, nil),
+	}}
+	var w grpcWorker
+	br, err := w.ServeTaskBatch(context.Background(), bq)
+	require.NoError(t, err)
+	require.Len(t, br.Results, 3)
+	require.Len(t, br.Errors, 3)
+
+	require.Empty(t, br.Errors[0])
+	require.EqualValues(t, [][]uint64{{23, 25, 26, 31}},
+		algo.ToUintsListForTest(br.Results[0].UidMatrix))
+	require.Contains(t, br.Errors[1], "Request sent to wrong server")
+	require.Empty(t, br.Errors[2])
+	require.EqualValues(t, [][]uint64{{23, 31}, {23}},
+		algo.ToUintsListForTest(br.Results[2].UidMatrix))
+}
@@ -458,14 +458,14 @@ func (n *node) saveToStorage(s raftpb.Snapshot, h raftpb.HardState,
 	n.store.Append(es)
 }
 
-func (n *node) retrieveSnapshot(rc task.RaftContext) {
+func (n *node) retrieveSnapshot(rc task.RaftContext, index uint64) {
 	addr := n.peers.Get(rc.Id)
 	x.AssertTruef(addr != "", "Should have the address for %d", rc.Id)
 	pool := pools().get(addr)
 	x.AssertTruef(pool != nil, "Pool shouldn't be nil for address: %v for id: %v", addr, rc.Id)
 
 	x.AssertTrue(rc.Group == n.gid)
-	x.Check2(populateShard(n.ctx, pool, n.gid))
+	x.Check(bootstrapShard(n.ctx, pool, n.gid, index))
 }
 
 func (n *node) Run() {
@@ -501,7 +501,7 @@ func (n *node) Run() {
 				x.Check(rc.Unmarshal(rd.Snapshot.Data))
 				if rc.Id != n.id {
 					fmt.Printf("-------> SNAPSHOT [%d] from %d\n", n.gid, rc.Id)
-					n.retrieveSnapshot(rc)
+					n.retrieveSnapshot(rc, rd.Snapshot.Metadata.Index)
 					fmt.Printf("-------> SNAPSHOT [%d]. DONE.\n", n.gid)
 				} else {
 					fmt.Printf("-------> SNAPSHOT [%d] from %d [SELF]. Ignoring.\n", n.gid, rc.Id)
@@ -576,6 +576,12 @@ func (n *node) snapshotPeriodically() {
 				fmt.Println(msg)
 			}
 
+			if pstore.SkipsWAL() {
+				// Writes up to the watermark may only be in memtables. Persist them
+				// before compacting away the RAFT entries which could replay them.
+				x.Checkf(pstore.Flush(), "While flushing postings store")
+			}
+
 			rc, err := n.raftContext.Marshal()
 			x.Check(err)
 
@@ -600,7 +606,7 @@ func (n *node) joinPeers() {
 	x.AssertTruef(pool != nil, "Unable to get pool for addr: %q for peer: %d", paddr, pid)
 
 	// Bring the instance up to speed first.
-	_, err := populateShard(n.ctx, pool, n.gid)
+	err := bootstrapShard(n.ctx, pool, n.gid, 0)
 	x.Checkf(err, "Error while populating shard")
 
 	conn, err := pool.Get()
@@ -37,22 +37,21 @@ func runMutations(ctx context.Context, edges []*task.DirectedEdge) error {
 		if !groups().ServesGroup(group.BelongsTo(edge.Attr)) {
 			return x.Errorf("Predicate fingerprint doesn't match this instance")
 		}
-
-		var group uint32
-		if rv, ok := ctx.Value("raft").(x.RaftValue); ok {
-			group = rv.Group
-		}
-
-		key := x.DataKey(edge.Attr, edge.Entity)
-		plist, decr := posting.GetOrCreate(key, group)
-		defer decr()
-
-		if err := plist.AddMutationWithIndex(ctx, edge); err != nil {
-			x.Printf("Error while adding mutation: %v %v", edge, err)
-			return err // abort applying the rest of them.
-		}
 	}
-	return nil
+	if pstore != nil && pstore.ReadOnly() {
+		// The lists couldn't be committed. This also skips the entries replayed
+		// from the RAFT log on restart, which the store is assumed to contain.
+		return x.Errorf("Posting store is read-only")
+	}
+	if rv, ok := ctx.Value("raft").(x.RaftValue); ok {
+		taskCache.touch(rv.Index, edges)
+	} else {
+		// Without an index, we can't tell which cached results were computed while
+		// the edges were being applied.
+		taskCache.clear()
+		defer taskCache.clear()
+	}
+	return posting.AddMutationsWithIndex(ctx, edges)
 }
 
 // runMutate is used to run the mutations on an instance.
@@ -11,6 +11,8 @@
 	It has these top-level messages:
 		Payload
 		BackupPayload
+		CheckpointRequest
+		CheckpointChunk
 */
 package worker
 
@@ -117,9 +119,78 @@ func (m *BackupPayload) GetStatus() BackupPayload_Status {
 	return BackupPayload_NONE
 }
 
+// CheckpointRequest asks the leader of a group for a RocksDB checkpoint of its
+// posting store.
+type CheckpointRequest struct {
+	GroupId uint32 `protobuf:"varint,1,opt,name=group_id,json=groupId,proto3" json:"group_id,omitempty"`
+}
+
+func (m *CheckpointRequest) Reset()                    { *m = CheckpointRequest{} }
+func (m *CheckpointRequest) String() string            { return proto.CompactTextString(m) }
+func (*CheckpointRequest) ProtoMessage()               {}
+func (*CheckpointRequest) Descriptor() ([]byte, []int) { return fileDescriptorPayload, []int{2} }
+
+func (m *CheckpointRequest) GetGroupId() uint32 {
+	if m != nil {
+		return m.GroupId
+	}
+	return 0
+}
+
+// CheckpointChunk carries a piece of one of the files in a RocksDB checkpoint.
+type CheckpointChunk struct {
+	Name     string `protobuf:"bytes,1,opt,name=name,proto3" json:"name,omitempty"`
+	Offset   uint64 `protobuf:"varint,2,opt,name=offset,proto3" json:"offset,omitempty"`
+	Data     []byte `protobuf:"bytes,3,opt,name=data,proto3" json:"data,omitempty"`
+	Checksum uint32 `protobuf:"varint,4,opt,name=checksum,proto3" json:"checksum,omitempty"`
+	Index    uint64 `protobuf:"varint,5,opt,name=index,proto3" json:"index,omitempty"`
+}
+
+func (m *CheckpointChunk) Reset()                    { *m = CheckpointChunk{} }
+func (m *CheckpointChunk) String() string            { return proto.CompactTextString(m) }
+func (*CheckpointChunk) ProtoMessage()               {}
+func (*CheckpointChunk) Descriptor() ([]byte, []int) { return fileDescriptorPayload, []int{3} }
+
+func (m *CheckpointChunk) GetName() string {
+	if m != nil {
+		return m.Name
+	}
+	return ""
+}
+
+func (m *CheckpointChunk) GetOffset() uint64 {
+	if m != nil {
+		return m.Offset
+	}
+	return 0
+}
+
+func (m *CheckpointChunk) GetData() []byte {
+	if m != nil {
+		return m.Data
+	}
+	return nil
+}
+
+func (m *CheckpointChunk) GetChecksum() uint32 {
+	if m != nil {
+		return m.Checksum
+	}
+	return 0
+}
+
+func (m *CheckpointChunk) GetIndex() uint64 {
+	if m != nil {
+		return m.Index
+	}
+	return 0
+}
+
 func init() {
 	proto.RegisterType((*Payload)(nil), "worker.Payload")
 	proto.RegisterType((*BackupPayload)(nil), "worker.BackupPayload")
+	proto.RegisterType((*CheckpointRequest)(nil), "worker.CheckpointRequest")
+	proto.RegisterType((*CheckpointChunk)(nil), "worker.CheckpointChunk")
 	proto.RegisterEnum("worker.BackupPayload_Status", BackupPayload_Status_name, BackupPayload_Status_value)
 }
 
@@ -140,7 +211,9 @@ type WorkerClient interface {
 	AssignUids(ctx context.Context, in *task.Num, opts ...grpc.CallOption) (*task.List, error)
 	Mutate(ctx context.Context, in *task.Mutations, opts ...grpc.CallOption) (*Payload, error)
 	ServeTask(ctx context.Context, in *task.Query, opts ...grpc.CallOption) (*task.Result, error)
+	ServeTaskBatch(ctx context.Context, in *task.BatchQuery, opts ...grpc.CallOption) (*task.BatchResult, error)
 	PredicateData(ctx context.Context, opts ...grpc.CallOption) (Worker_PredicateDataClient, error)
+	PredicateCheckpoint(ctx context.Context, in *CheckpointRequest, opts ...grpc.CallOption) (Worker_PredicateCheckpointClient, error)
 	Sort(ctx context.Context, in *task.Sort, opts ...grpc.CallOption) (*task.SortResult, error)
 	// RAFT serving RPCs.
 	RaftMessage(ctx context.Context, in *Payload, opts ...grpc.CallOption) (*Payload, error)
@@ -193,6 +266,15 @@ func (c *workerClient) ServeTask(ctx context.Context, in *task.Query, opts ...gr
 	return out, nil
 }
 
+func (c *workerClient) ServeTaskBatch(ctx context.Context, in *task.BatchQuery, opts ...grpc.CallOption) (*task.BatchResult, error) {
+	out := new(task.BatchResult)
+	err := grpc.Invoke(ctx, "/worker.Worker/ServeTaskBatch", in, out, c.cc, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
 func (c *workerClient) PredicateData(ctx context.Context, opts ...grpc.CallOption) (Worker_PredicateDataClient, error) {
 	stream, err := grpc.NewClientStream(ctx, &_Worker_serviceDesc.Streams[0], c.cc, "/worker.Worker/PredicateData", opts...)
 	if err != nil {
@@ -224,6 +306,38 @@ func (x *workerPredicateDataClient) Recv() (*task.KV, error) {
 	return m, nil
 }
 
+func (c *workerClient) PredicateCheckpoint(ctx context.Context, in *CheckpointRequest, opts ...grpc.CallOption) (Worker_PredicateCheckpointClient, error) {
+	stream, err := grpc.NewClientStream(ctx, &_Worker_serviceDesc.Streams[1], c.cc, "/worker.Worker/PredicateCheckpoint", opts...)
+	if err != nil {
+		return nil, err
+	}
+	x := &workerPredicateCheckpointClient{stream}
+	if err := x.ClientStream.SendMsg(in); err != nil {
+		return nil, err
+	}
+	if err := x.ClientStream.CloseSend(); err != nil {
+		return nil, err
+	}
+	return x, nil
+}
+
+type Worker_PredicateCheckpointClient interface {
+	Recv() (*CheckpointChunk, error)
+	grpc.ClientStream
+}
+
+type workerPredicateCheckpointClient struct {
+	grpc.ClientStream
+}
+
+func (x *workerPredicateCheckpointClient) Recv() (*CheckpointChunk, error) {
+	m := new(CheckpointChunk)
+	if err := x.ClientStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
 func (c *workerClient) Sort(ctx context.Context, in *task.Sort, opts ...grpc.CallOption) (*task.SortResult, error) {
 	out := new(task.SortResult)
 	err := grpc.Invoke(ctx, "/worker.Worker/Sort", in, out, c.cc, opts...)
@@ -278,7 +392,9 @@ type WorkerServer interface {
 	AssignUids(context.Context, *task.Num) (*task.List, error)
 	Mutate(context.Context, *task.Mutations) (*Payload, error)
 	ServeTask(context.Context, *task.Query) (*task.Result, error)
+	ServeTaskBatch(context.Context, *task.BatchQuery) (*task.BatchResult, error)
 	PredicateData(Worker_PredicateDataServer) error
+	PredicateCheckpoint(*CheckpointRequest, Worker_PredicateCheckpointServer) error
 	Sort(context.Context, *task.Sort) (*task.SortResult, error)
 	// RAFT serving RPCs.
 	RaftMessage(context.Context, *Payload) (*Payload, error)
@@ -363,6 +479,24 @@ func _Worker_ServeTask_Handler(srv interface{}, ctx context.Context, dec func(in
 	return interceptor(ctx, in, info, handler)
 }
 
+func _Worker_ServeTaskBatch_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(task.BatchQuery)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(WorkerServer).ServeTaskBatch(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: "/worker.Worker/ServeTaskBatch",
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(WorkerServer).ServeTaskBatch(ctx, req.(*task.BatchQuery))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
 func _Worker_PredicateData_Handler(srv interface{}, stream grpc.ServerStream) error {
 	return srv.(WorkerServer).PredicateData(&workerPredicateDataServer{stream})
 }
@@ -389,6 +523,27 @@ func (x *workerPredicateDataServer) Recv() (*task.GroupKeys, error) {
 	return m, nil
 }
 
+func _Worker_PredicateCheckpoint_Handler(srv interface{}, stream grpc.ServerStream) error {
+	m := new(CheckpointRequest)
+	if err := stream.RecvMsg(m); err != nil {
+		return err
+	}
+	return srv.(WorkerServer).PredicateCheckpoint(m, &workerPredicateCheckpointServer{stream})
+}
+
+type Worker_PredicateCheckpointServer interface {
+	Send(*CheckpointChunk) error
+	grpc.ServerStream
+}
+
+type workerPredicateCheckpointServer struct {
+	grpc.ServerStream
+}
+
+func (x *workerPredicateCheckpointServer) Send(m *CheckpointChunk) error {
+	return x.ServerStream.SendMsg(m)
+}
+
 func _Worker_Sort_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
 	in := new(task.Sort)
 	if err := dec(in); err != nil {
@@ -499,6 +654,10 @@ var _Worker_serviceDesc = grpc.ServiceDesc{
 			MethodName: "ServeTask",
 			Handler:    _Worker_ServeTask_Handler,
 		},
+		{
+			MethodName: "ServeTaskBatch",
+			Handler:    _Worker_ServeTaskBatch_Handler,
+		},
 		{
 			MethodName: "Sort",
 			Handler:    _Worker_Sort_Handler,
@@ -527,6 +686,11 @@ var _Worker_serviceDesc = grpc.ServiceDesc{
 			ServerStreams: true,
 			ClientStreams: true,
 		},
+		{
+			StreamName:    "PredicateCheckpoint",
+			Handler:       _Worker_PredicateCheckpoint_Handler,
+			ServerStreams: true,
+		},
 	},
 	Metadata: "worker/payload.proto",
 }
@@ -588,6 +752,74 @@ func (m *BackupPayload) MarshalTo(dAtA []byte) (int, error) {
 	return i, nil
 }
 
+func (m *CheckpointRequest) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *CheckpointRequest) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
+	var l int
+	_ = l
+	if m.GroupId != 0 {
+		dAtA[i] = 0x8
+		i++
+		i = encodeVarintPayload(dAtA, i, uint64(m.GroupId))
+	}
+	return i, nil
+}
+
+func (m *CheckpointChunk) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *CheckpointChunk) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
+	var l int
+	_ = l
+	if len(m.Name) > 0 {
+		dAtA[i] = 0xa
+		i++
+		i = encodeVarintPayload(dAtA, i, uint64(len(m.Name)))
+		i += copy(dAtA[i:], m.Name)
+	}
+	if m.Offset != 0 {
+		dAtA[i] = 0x10
+		i++
+		i = encodeVarintPayload(dAtA, i, uint64(m.Offset))
+	}
+	if len(m.Data) > 0 {
+		dAtA[i] = 0x1a
+		i++
+		i = encodeVarintPayload(dAtA, i, uint64(len(m.Data)))
+		i += copy(dAtA[i:], m.Data)
+	}
+	if m.Checksum != 0 {
+		dAtA[i] = 0x20
+		i++
+		i = encodeVarintPayload(dAtA, i, uint64(m.Checksum))
+	}
+	if m.Index != 0 {
+		dAtA[i] = 0x28
+		i++
+		i = encodeVarintPayload(dAtA, i, uint64(m.Index))
+	}
+	return i, nil
+}
+
 func encodeFixed64Payload(dAtA []byte, offset int, v uint64) int {
 	dAtA[offset] = uint8(v)
 	dAtA[offset+1] = uint8(v >> 8)
@@ -640,6 +872,38 @@ func (m *BackupPayload) Size() (n int) {
 	return n
 }
 
+func (m *CheckpointRequest) Size() (n int) {
+	var l int
+	_ = l
+	if m.GroupId != 0 {
+		n += 1 + sovPayload(uint64(m.GroupId))
+	}
+	return n
+}
+
+func (m *CheckpointChunk) Size() (n int) {
+	var l int
+	_ = l
+	l = len(m.Name)
+	if l > 0 {
+		n += 1 + l + sovPayload(uint64(l))
+	}
+	if m.Offset != 0 {
+		n += 1 + sovPayload(uint64(m.Offset))
+	}
+	l = len(m.Data)
+	if l > 0 {
+		n += 1 + l + sovPayload(uint64(l))
+	}
+	if m.Checksum != 0 {
+		n += 1 + sovPayload(uint64(m.Checksum))
+	}
+	if m.Index != 0 {
+		n += 1 + sovPayload(uint64(m.Index))
+	}
+	return n
+}
+
 func sovPayload(x uint64) (n int) {
 	for {
 		n++
@@ -841,6 +1105,242 @@ func (m *BackupPayload) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
+func (m *CheckpointRequest) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowPayload
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: CheckpointRequest: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: CheckpointRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field GroupId", wireType)
+			}
+			m.GroupId = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPayload
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.GroupId |= (uint32(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		default:
+			iNdEx = preIndex
+			skippy, err := skipPayload(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthPayload
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *CheckpointChunk) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowPayload
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: CheckpointChunk: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: CheckpointChunk: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Name", wireType)
+			}
+			var stringLen uint64
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPayload
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				stringLen |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			intStringLen := int(stringLen)
+			if intStringLen < 0 {
+				return ErrInvalidLengthPayload
+			}
+			postIndex := iNdEx + intStringLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Name = string(dAtA[iNdEx:postIndex])
+			iNdEx = postIndex
+		case 2:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Offset", wireType)
+			}
+			m.Offset = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPayload
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Offset |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 3:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Data", wireType)
+			}
+			var byteLen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPayload
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				byteLen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if byteLen < 0 {
+				return ErrInvalidLengthPayload
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Data = append(m.Data[:0], dAtA[iNdEx:postIndex]...)
+			if m.Data == nil {
+				m.Data = []byte{}
+			}
+			iNdEx = postIndex
+		case 4:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Checksum", wireType)
+			}
+			m.Checksum = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPayload
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Checksum |= (uint32(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 5:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Index", wireType)
+			}
+			m.Index = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPayload
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Index |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		default:
+			iNdEx = preIndex
+			skippy, err := skipPayload(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthPayload
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
 func skipPayload(dAtA []byte) (n int, err error) {
 	l := len(dAtA)
 	iNdEx := 0
@@ -949,37 +1449,44 @@ var (
 func init() { proto.RegisterFile("worker/payload.proto", fileDescriptorPayload) }
 
 var fileDescriptorPayload = []byte{
-	// 505 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x09, 0x6e, 0x88, 0x02, 0xff, 0x8c, 0x92, 0xcd, 0x6e, 0xd3, 0x40,
-	0x10, 0xc7, 0xbd, 0xad, 0x71, 0x92, 0x49, 0x43, 0xcd, 0x88, 0xa2, 0x62, 0x41, 0x14, 0x59, 0x02,
-	0x45, 0x7c, 0x38, 0xa5, 0xe5, 0x80, 0xb8, 0xa5, 0x49, 0x40, 0xa1, 0x49, 0x08, 0x76, 0x03, 0x47,
-	0xb4, 0x89, 0xb7, 0x89, 0x95, 0x8f, 0x75, 0x77, 0xd7, 0x40, 0xde, 0x84, 0xf7, 0xe0, 0x25, 0x38,
-	0xf2, 0x08, 0x28, 0x3c, 0x03, 0x77, 0x14, 0xaf, 0x53, 0x04, 0x0a, 0x12, 0x17, 0x6b, 0xe6, 0xe7,
-	0xff, 0xfc, 0x67, 0x34, 0x3b, 0x70, 0xf3, 0x23, 0x17, 0x53, 0x26, 0x6a, 0x31, 0x5d, 0xce, 0x38,
-	0x0d, 0xbd, 0x58, 0x70, 0xc5, 0xd1, 0xd2, 0xd4, 0x79, 0x38, 0x8e, 0xd4, 0x24, 0x19, 0x7a, 0x23,
-	0x3e, 0xaf, 0x85, 0x63, 0x41, 0xe3, 0xc9, 0xe3, 0x88, 0x67, 0x51, 0x4d, 0x51, 0x39, 0x4d, 0x3f,
-	0xba, 0xc8, 0xbd, 0x0b, 0xb9, 0xbe, 0x76, 0x41, 0x04, 0xb3, 0x49, 0x15, 0x3d, 0x24, 0x15, 0x52,
-	0xdd, 0xf3, 0xcd, 0x90, 0x2a, 0xea, 0x7e, 0x21, 0x50, 0x3a, 0xa5, 0xa3, 0x69, 0x12, 0x6f, 0x54,
-	0x07, 0x60, 0x09, 0x76, 0xf9, 0x3e, 0x0a, 0x53, 0x9d, 0xe9, 0x5f, 0x13, 0xec, 0xb2, 0x1d, 0xe2,
-	0x6d, 0xc8, 0x8f, 0x05, 0x4f, 0xe2, 0xf5, 0x8f, 0x9d, 0x0a, 0xa9, 0x96, 0xfc, 0x5c, 0x9a, 0xb7,
-	0x43, 0x7c, 0x0a, 0x96, 0x54, 0x54, 0x25, 0xf2, 0x70, 0xb7, 0x42, 0xaa, 0xd7, 0x8f, 0xef, 0x78,
-	0x7a, 0x50, 0xef, 0x0f, 0x63, 0x2f, 0x48, 0x35, 0x7e, 0xa6, 0x75, 0x9f, 0x83, 0xa5, 0x09, 0xe6,
-	0xc1, 0xec, 0xbd, 0xee, 0xb5, 0x6c, 0x03, 0x8b, 0x90, 0x0b, 0x06, 0x8d, 0x46, 0x2b, 0x08, 0x6c,
-	0x82, 0x25, 0x28, 0x34, 0x07, 0xfd, 0x4e, 0xbb, 0x51, 0x3f, 0x6f, 0xd9, 0x3b, 0x08, 0x60, 0xbd,
-	0xa8, 0xb7, 0x3b, 0xad, 0xa6, 0xbd, 0x7b, 0xfc, 0x73, 0x17, 0xac, 0x77, 0x69, 0x0f, 0x7c, 0x00,
-	0x66, 0x6b, 0x34, 0xe1, 0xb8, 0xbf, 0x69, 0x9a, 0xb5, 0x73, 0xfe, 0x06, 0xae, 0x81, 0xf7, 0x00,
-	0xea, 0x52, 0x46, 0xe3, 0xc5, 0x20, 0x0a, 0x25, 0x16, 0xbc, 0x74, 0x4d, 0xbd, 0x64, 0xee, 0x80,
-	0x0e, 0x3b, 0x91, 0x54, 0xae, 0x81, 0x8f, 0xc0, 0xea, 0x26, 0x8a, 0x2a, 0x86, 0xfb, 0x9a, 0xa7,
-	0x59, 0xc4, 0x17, 0x72, 0x9b, 0x69, 0x15, 0x0a, 0x01, 0x13, 0x1f, 0xd8, 0x39, 0x95, 0x53, 0x2c,
-	0xea, 0x82, 0x37, 0x09, 0x13, 0x4b, 0x67, 0x4f, 0x27, 0x3e, 0x93, 0xc9, 0x6c, 0xed, 0x7b, 0x04,
-	0xa5, 0xbe, 0x60, 0x61, 0x34, 0xa2, 0x8a, 0xad, 0x1f, 0x62, 0x63, 0xff, 0x72, 0xbd, 0xc7, 0x33,
-	0xb6, 0x94, 0x4e, 0x5e, 0x83, 0xb3, 0xb7, 0xae, 0x51, 0x25, 0x47, 0x04, 0xef, 0x83, 0x19, 0x70,
-	0xa1, 0x30, 0x9b, 0x6f, 0x1d, 0x3b, 0xf6, 0xef, 0xf8, 0xca, 0xf9, 0x09, 0x14, 0x7d, 0x7a, 0xa1,
-	0xba, 0x4c, 0x4a, 0x3a, 0x66, 0xff, 0xb5, 0x8b, 0x13, 0x28, 0xbe, 0xe2, 0xd1, 0xa2, 0x31, 0x4b,
-	0xa4, 0x62, 0x02, 0x6f, 0x64, 0xb3, 0xd2, 0x0b, 0xd5, 0xe0, 0x0b, 0xc5, 0x3e, 0xa9, 0x6d, 0x45,
-	0x4d, 0xb0, 0x07, 0x71, 0x48, 0x15, 0xeb, 0xb2, 0xf9, 0x90, 0x09, 0x39, 0x89, 0x62, 0xbc, 0x95,
-	0xed, 0xe8, 0x8a, 0x68, 0x85, 0xf3, 0x0f, 0xee, 0x1a, 0xf8, 0x0c, 0x2c, 0x7d, 0x19, 0x78, 0xb0,
-	0xf5, 0x52, 0x9c, 0xed, 0xd8, 0x35, 0x4e, 0xed, 0xaf, 0xab, 0x32, 0xf9, 0xb6, 0x2a, 0x93, 0xef,
-	0xab, 0x32, 0xf9, 0xfc, 0xa3, 0x6c, 0x0c, 0xad, 0xf4, 0xca, 0x4f, 0x7e, 0x05, 0x00, 0x00, 0xff,
-	0xff, 0xb5, 0x02, 0x57, 0x6a, 0x32, 0x03, 0x00, 0x00,
+	// 612 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x09, 0x6e, 0x88, 0x02, 0xff, 0x8c, 0x54, 0x5d, 0x4f, 0xdb, 0x48,
+	0x14, 0xb5, 0xc1, 0x98, 0xe4, 0x86, 0x80, 0xb9, 0x0b, 0x6c, 0xb0, 0x76, 0x25, 0x64, 0x69, 0x57,
+	0x51, 0x3f, 0x0c, 0x85, 0x4a, 0xad, 0xfa, 0x06, 0x4e, 0x5a, 0xa5, 0x10, 0x4a, 0x1d, 0xd2, 0x3e,
+	0x56, 0x83, 0x3d, 0xc4, 0x56, 0x88, 0xc7, 0xcc, 0x8c, 0x5b, 0x78, 0xee, 0x4f, 0xea, 0xef, 0xab,
+	0x54, 0x79, 0xc6, 0x09, 0xa5, 0xa4, 0x52, 0x5f, 0xa2, 0x7b, 0xcf, 0x9c, 0x73, 0x73, 0xe7, 0x9c,
+	0x4c, 0x60, 0xe3, 0x0b, 0xe3, 0x63, 0xca, 0x77, 0x73, 0x72, 0x7b, 0xc5, 0x48, 0xec, 0xe7, 0x9c,
+	0x49, 0x86, 0xb6, 0x46, 0xdd, 0xc7, 0xa3, 0x54, 0x26, 0xc5, 0x85, 0x1f, 0xb1, 0xc9, 0x6e, 0x3c,
+	0xe2, 0x24, 0x4f, 0x9e, 0xa6, 0xac, 0xaa, 0x76, 0x25, 0x11, 0x63, 0xf5, 0xa1, 0x45, 0xde, 0xbf,
+	0xb0, 0x7c, 0xa6, 0xa7, 0x20, 0x82, 0xd5, 0x21, 0x92, 0xb4, 0xcc, 0x1d, 0xb3, 0xbd, 0x12, 0xaa,
+	0xda, 0xfb, 0x66, 0x42, 0xf3, 0x88, 0x44, 0xe3, 0x22, 0x9f, 0xb2, 0x36, 0xc1, 0xe6, 0xf4, 0xfa,
+	0x53, 0x1a, 0x2b, 0x9e, 0x15, 0x2e, 0x71, 0x7a, 0xdd, 0x8b, 0x71, 0x1b, 0x6a, 0x23, 0xce, 0x8a,
+	0xbc, 0x3c, 0x58, 0xd8, 0x31, 0xdb, 0xcd, 0x70, 0x59, 0xf5, 0xbd, 0x18, 0x9f, 0x83, 0x2d, 0x24,
+	0x91, 0x85, 0x68, 0x2d, 0xee, 0x98, 0xed, 0xd5, 0xfd, 0x7f, 0x7c, 0xbd, 0xa8, 0x7f, 0x6f, 0xb0,
+	0x3f, 0x50, 0x9c, 0xb0, 0xe2, 0x7a, 0xaf, 0xc0, 0xd6, 0x08, 0xd6, 0xc0, 0x3a, 0x7d, 0x77, 0xda,
+	0x75, 0x0c, 0x6c, 0xc0, 0xf2, 0x60, 0x18, 0x04, 0xdd, 0xc1, 0xc0, 0x31, 0xb1, 0x09, 0xf5, 0xce,
+	0xf0, 0xec, 0xa4, 0x17, 0x1c, 0x9e, 0x77, 0x9d, 0x05, 0x04, 0xb0, 0x5f, 0x1f, 0xf6, 0x4e, 0xba,
+	0x1d, 0x67, 0xd1, 0xf3, 0x61, 0x3d, 0x48, 0x68, 0x34, 0xce, 0x59, 0x9a, 0xc9, 0x90, 0x5e, 0x17,
+	0x54, 0xc8, 0x7b, 0x1b, 0x9a, 0xf7, 0x36, 0xf4, 0xbe, 0x9a, 0xb0, 0x76, 0x27, 0x08, 0x92, 0x22,
+	0x1b, 0x97, 0x6e, 0x64, 0x64, 0x42, 0x15, 0xb5, 0x1e, 0xaa, 0x1a, 0xb7, 0xc0, 0x66, 0x97, 0x97,
+	0x82, 0x4a, 0x75, 0x45, 0x2b, 0xac, 0xba, 0x92, 0x1b, 0x97, 0xce, 0x2d, 0x6a, 0xe7, 0xca, 0x1a,
+	0x5d, 0xa8, 0x45, 0xe5, 0x48, 0x51, 0x4c, 0x5a, 0x96, 0xfa, 0xba, 0x59, 0x8f, 0x1b, 0xb0, 0x94,
+	0x66, 0x31, 0xbd, 0x69, 0x2d, 0x69, 0x0b, 0x55, 0xb3, 0xff, 0xdd, 0x02, 0xfb, 0xa3, 0x72, 0x06,
+	0x1f, 0x81, 0xd5, 0x8d, 0x12, 0x86, 0x6b, 0x53, 0xab, 0x2a, 0x93, 0xdc, 0x5f, 0x01, 0xcf, 0xc0,
+	0xff, 0x00, 0x0e, 0x85, 0x48, 0x47, 0xd9, 0x30, 0x8d, 0x05, 0xd6, 0x7d, 0x15, 0xee, 0x69, 0x31,
+	0x71, 0x41, 0x97, 0x27, 0xa9, 0x90, 0x9e, 0x81, 0x4f, 0xc0, 0xee, 0x17, 0x92, 0x48, 0x8a, 0x6b,
+	0x1a, 0x57, 0x5d, 0xca, 0x32, 0x31, 0x6f, 0x68, 0x1b, 0xea, 0x03, 0xca, 0x3f, 0xd3, 0x73, 0x22,
+	0xc6, 0xd8, 0xd0, 0x82, 0xf7, 0x05, 0xe5, 0xb7, 0xee, 0x8a, 0x6e, 0x42, 0x2a, 0x8a, 0xab, 0x72,
+	0xee, 0x0b, 0x58, 0x9d, 0x31, 0x8f, 0x88, 0x8c, 0x12, 0x74, 0x34, 0x43, 0x35, 0x5a, 0xb3, 0xfe,
+	0x13, 0x32, 0x13, 0xee, 0x41, 0xf3, 0x8c, 0xd3, 0x38, 0x8d, 0x88, 0xa4, 0xe5, 0x6f, 0x6d, 0xba,
+	0xd7, 0x9b, 0x32, 0x94, 0x63, 0x7a, 0x2b, 0xdc, 0x9a, 0x06, 0x8e, 0x3f, 0x78, 0x46, 0xdb, 0xdc,
+	0x33, 0xb1, 0x0f, 0x7f, 0xcd, 0x14, 0x77, 0x71, 0xe1, 0xf6, 0x74, 0xfd, 0x07, 0x99, 0xbb, 0x7f,
+	0x3f, 0x3c, 0x52, 0xe9, 0x7a, 0xc6, 0x9e, 0x89, 0xff, 0x83, 0x35, 0x60, 0x5c, 0x62, 0xe5, 0x53,
+	0x59, 0xbb, 0xce, 0x5d, 0x3d, 0x5b, 0xf4, 0x19, 0x34, 0x42, 0x72, 0x29, 0xfb, 0x54, 0x08, 0x32,
+	0xa2, 0x7f, 0x94, 0xc9, 0x01, 0x34, 0xde, 0xb2, 0x34, 0x0b, 0xae, 0x0a, 0x21, 0x29, 0xc7, 0xea,
+	0xfe, 0xe5, 0x94, 0x80, 0x65, 0x92, 0xde, 0xc8, 0x79, 0xa2, 0x0e, 0x38, 0xc3, 0x3c, 0x26, 0x92,
+	0xf6, 0xe9, 0xe4, 0x82, 0x72, 0x91, 0xa4, 0x39, 0x6e, 0x55, 0x59, 0xcd, 0x10, 0xcd, 0x70, 0x7f,
+	0x83, 0x7b, 0x06, 0xbe, 0x04, 0x5b, 0xbf, 0x2b, 0xdc, 0x9c, 0xfb, 0xce, 0xdc, 0xf9, 0xb0, 0x67,
+	0x5c, 0xd8, 0xea, 0x1f, 0xe1, 0xe0, 0x47, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa2, 0xec, 0x19, 0x2c,
+	0x5e, 0x04, 0x00, 0x00,
 }
@@ -209,9 +209,8 @@ func (w *grpcWorker) PredicateData(stream Worker_PredicateDataServer) error {
 		return x.Errorf("Not leader of group: %d", gkeys.GroupId)
 	}
 
-	// TODO(pawan) - Shift to CheckPoints once we figure out how to add them to the
-	// RocksDB library we are using.
-	// http://rocksdb.org/blog/2609/use-checkpoints-for-efficient-snapshots/
+	// With --checkpoint_bootstrap, followers only fall back to this when a
+	// checkpoint can't be used. See bootstrapShard.
 	it := pstore.NewIterator()
 	defer it.Close()
 
@@ -45,7 +45,20 @@ func ProcessTaskOverNetwork(ctx context.Context, q *task.Query) (*task.Result, e
 
 	if groups().ServesGroup(gid) {
 		// No need for a network call, as this should be run from within this instance.
-		return processTask(q, gid)
+		return processTaskWithCache(q, gid)
+	}
+
+	if *taskBatchWindow > 0 {
+		// Coalesce with other queries to the same group, and send them in one RPC.
+		x.Trace(ctx, "Dispatching request to group: %v", gid)
+		reply, err := dispatcherFor(gid).process(ctx, q)
+		if err != nil {
+			x.TraceError(ctx, x.Wrapf(err, "Error while calling Worker.ServeTaskBatch"))
+			return &emptyResult, err
+		}
+		x.Trace(ctx, "Reply from group: %v length: %v Attr: %v",
+			gid, len(reply.UidMatrix), attr)
+		return reply, nil
 	}
 
 	// Send this over the network.
@@ -273,7 +286,7 @@ func (w *grpcWorker) ServeTask(ctx context.Context, q *task.Query) (*task.Result
 	c := make(chan error, 1)
 	go func() {
 		var err error
-		reply, err = processTask(q, gid)
+		reply, err = processTaskWithCache(q, gid)
 		c <- err
 	}()
 
@@ -18,14 +18,18 @@ package worker
 
 import (
 	"context"
+	"fmt"
 	"io/ioutil"
 	"os"
+	"strings"
 	"testing"
 	"time"
 
 	"github.com/stretchr/testify/require"
 
 	"github.com/dgraph-io/dgraph/algo"
+	"github.com/dgraph-io/dgraph/bench"
+	"github.com/dgraph-io/dgraph/group"
 	"github.com/dgraph-io/dgraph/posting"
 	"github.com/dgraph-io/dgraph/schema"
 	"github.com/dgraph-io/dgraph/store"
@@ -606,3 +610,119 @@ func TestMain(m *testing.M) {
 	x.Init()
 	os.Exit(m.Run())
 }
+
+// loadBenchGraph loads the synthetic graph, with an indexed string, int and geo
+// predicate, and a uid predicate with reverse edges.
+func loadBenchGraph(b *testing.B) (*bench.Graph, func()) {
+	schema.ParseBytes([]byte(`
+		scalar friend:uid @reverse
+		scalar name:string @index
+		scalar age:int @index
+		scalar loc:geo @index
+	`))
+	if err := group.ParseGroupConfig(""); err != nil {
+		b.Fatal(err)
+	}
+	dir, err := ioutil.TempDir("", "storetest_")
+	if err != nil {
+		b.Fatal(err)
+	}
+	ps, err := store.NewStore(dir)
+	if err != nil {
+		b.Fatal(err)
+	}
+	posting.Init(ps)
+
+	g := bench.NewGraph(bench.DefaultConfig)
+	var edges []*task.DirectedEdge
+	edges = append(edges, g.UidEdges("friend")...)
+	edges = append(edges, g.StringEdges("name")...)
+	edges = append(edges, g.IntEdges("age", 100)...)
+	edges = append(edges, g.GeoEdges("loc")...)
+	if err := posting.AddMutationsWithIndex(context.Background(), edges); err != nil {
+		b.Fatal(err)
+	}
+	return g, func() {
+		ps.Close()
+		os.RemoveAll(dir)
+	}
+}
+
+// BenchmarkProcessTask runs the task queries of the query layer against the
+// synthetic graph. Each kind cycles through 100 different queries.
+func BenchmarkProcessTask(b *testing.B) {
+	g, cleanup := loadBenchGraph(b)
+	defer cleanup()
+
+	const numQueries = 100
+	kinds := []struct {
+		name  string
+		query func(i int) *task.Query
+	}{
+		{"uids=100", func(i int) *task.Query {
+			return newQuery("friend", g.Uids(fmt.Sprintf("src%d", i), 100), nil)
+		}},
+		{"reverse", func(i int) *task.Query {
+			q := newQuery("friend", g.Uids(fmt.Sprintf("src%d", i), 10), nil)
+			q.Reverse = true
+			return q
+		}},
+		{"anyof", func(i int) *task.Query {
+			terms := g.Terms(fmt.Sprintf("name%d", i), 2)
+			return newQuery("name", nil, []string{"anyof", strings.Join(terms, " ")})
+		}},
+		{"geq", func(i int) *task.Query {
+			return newQuery("age", nil, []string{"geq", fmt.Sprintf("%d", 90+i%10)})
+		}},
+		{"near", func(i int) *task.Query {
+			return newQuery("loc", nil, g.NearArgs("loc", i, 1000))
+		}},
+	}
+	for _, k := range kinds {
+		b.Run(k.name, func(b *testing.B) {
+			queries := make([]*task.Query, numQueries)
+			for i := range queries {
+				queries[i] = k.query(i)
+			}
+			rec := bench.NewRecorder("worker/task/"+k.name, b.N)
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				rec.Start()
+				if _, err := processTask(queries[i%numQueries], 0); err != nil {
+					b.Fatal(err)
+				}
+				rec.Stop()
+			}
+			b.StopTimer()
+			rec.Report(b)
+		})
+	}
+}
+
+// BenchmarkProcessSort sorts lists of uids of the synthetic graph by the
+// indexed int predicate, and returns the first 10 of each.
+func BenchmarkProcessSort(b *testing.B) {
+	g, cleanup := loadBenchGraph(b)
+	defer cleanup()
+
+	for _, n := range []int{100, 1000, 10000} {
+		b.Run(fmt.Sprintf("uids=%d", n), func(b *testing.B) {
+			ts := &task.Sort{
+				Attr:      "age",
+				UidMatrix: []*task.List{{Uids: g.Uids("sort", n)}},
+				Count:     10,
+			}
+			rec := bench.NewRecorder(fmt.Sprintf("worker/sort/uids=%d", n), b.N)
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				rec.Start()
+				if _, err := processSort(ts); err != nil {
+					b.Fatal(err)
+				}
+				rec.Stop()
+			}
+			b.StopTimer()
+			rec.Report(b)
+		})
+	}
+}